@@ -0,0 +1,541 @@
+// File:    bytecode.cpp
+// Purpose: Compiled (flat bytecode) form of a parsed expression
+//------------------------------------------------------------------------------
+
+
+// Includes
+#include <cmath>
+#include <algorithm>
+
+#include "defs.h"
+#include "bytecode.h"
+#include "expr.h"
+
+using namespace std;
+using namespace ExprEval;
+
+namespace
+{
+    // Value with first derivative, for forward-mode differentiation
+    struct Dual
+    {
+        double v; // Value
+        double d; // Derivative
+    };
+
+    inline double Value(double a) { return a; }
+    inline double Value(const Dual &a) { return a.v; }
+
+    inline bool Finite(double a) { return std::isfinite(a); }
+    inline bool Finite(const Dual &a) { return std::isfinite(a.v) && std::isfinite(a.d); }
+
+    inline double Make(double v, double) { return v; }
+    inline Dual Make(double v, const Dual &) { Dual r = { v, 0.0 }; return r; }
+
+    // Unary operations
+    //--------------------------------------------------------------------------
+    double Apply(Program::OpCode op, double a)
+    {
+        double dummy;
+        switch(op)
+        {
+            case Program::OpNeg: return -a;
+            case Program::OpNot: return a == 0.0 ? 1.0 : 0.0;
+            case Program::OpAbs: return fabs(a);
+            case Program::OpSqrt: return sqrt(a);
+            case Program::OpSin: return sin(a);
+            case Program::OpCos: return cos(a);
+            case Program::OpTan: return tan(a);
+            case Program::OpSinh: return sinh(a);
+            case Program::OpCosh: return cosh(a);
+            case Program::OpTanh: return tanh(a);
+            case Program::OpAsin: return asin(a);
+            case Program::OpAcos: return acos(a);
+            case Program::OpAtan: return atan(a);
+            case Program::OpLog: return log10(a);
+            case Program::OpLn: return log(a);
+            case Program::OpExp: return exp(a);
+            case Program::OpFloor: return floor(a);
+            case Program::OpCeil: return ceil(a);
+            case Program::OpIpart: modf(a, &dummy); return dummy;
+            case Program::OpFpart: return modf(a, &dummy);
+            default: return NAN;
+        }
+    }
+
+    Dual Apply(Program::OpCode op, const Dual &a)
+    {
+        Dual r = { Apply(op, a.v), 0.0 };
+        switch(op)
+        {
+            case Program::OpNeg: r.d = -a.d; break;
+            case Program::OpAbs: r.d = a.v > 0.0 ? a.d : (a.v < 0.0 ? -a.d : 0.0); break;
+            case Program::OpSqrt: r.d = a.d / (2.0 * r.v); break;
+            case Program::OpSin: r.d = a.d * cos(a.v); break;
+            case Program::OpCos: r.d = -a.d * sin(a.v); break;
+            case Program::OpTan: r.d = a.d * (1.0 + r.v * r.v); break;
+            case Program::OpSinh: r.d = a.d * cosh(a.v); break;
+            case Program::OpCosh: r.d = a.d * sinh(a.v); break;
+            case Program::OpTanh: r.d = a.d * (1.0 - r.v * r.v); break;
+            case Program::OpAsin: r.d = a.d / sqrt(1.0 - a.v * a.v); break;
+            case Program::OpAcos: r.d = -a.d / sqrt(1.0 - a.v * a.v); break;
+            case Program::OpAtan: r.d = a.d / (1.0 + a.v * a.v); break;
+            case Program::OpLog: r.d = a.d / (a.v * log(10.0)); break;
+            case Program::OpLn: r.d = a.d / a.v; break;
+            case Program::OpExp: r.d = a.d * r.v; break;
+            case Program::OpFpart: r.d = a.d; break;
+            default: break; // Piecewise constant functions
+        }
+        return r;
+    }
+
+    // Binary operations
+    //--------------------------------------------------------------------------
+    double Apply(Program::OpCode op, double a, double b)
+    {
+        switch(op)
+        {
+            case Program::OpAdd: return a + b;
+            case Program::OpSub: return a - b;
+            case Program::OpMul: return a * b;
+            case Program::OpDiv: return b == 0.0 ? NAN : a / b;
+            case Program::OpPow: return pow(a, b);
+            case Program::OpMod: return fmod(a, b);
+            case Program::OpAtan2: return atan2(a, b);
+            case Program::OpMin: return b < a ? b : a;
+            case Program::OpMax: return b > a ? b : a;
+            case Program::OpEqual: return a == b ? 1.0 : 0.0;
+            case Program::OpAbove: return a > b ? 1.0 : 0.0;
+            case Program::OpBelow: return a < b ? 1.0 : 0.0;
+            case Program::OpAnd: return a == 0.0 || b == 0.0 ? 0.0 : 1.0;
+            case Program::OpOr: return a == 0.0 && b == 0.0 ? 0.0 : 1.0;
+            default: return NAN;
+        }
+    }
+
+    Dual Apply(Program::OpCode op, const Dual &a, const Dual &b)
+    {
+        Dual r = { Apply(op, a.v, b.v), 0.0 };
+        switch(op)
+        {
+            case Program::OpAdd: r.d = a.d + b.d; break;
+            case Program::OpSub: r.d = a.d - b.d; break;
+            case Program::OpMul: r.d = a.d * b.v + a.v * b.d; break;
+            case Program::OpDiv: r.d = (a.d - r.v * b.d) / b.v; break;
+            case Program::OpPow:
+                if(a.d != 0.0)
+                    r.d = b.v * pow(a.v, b.v - 1.0) * a.d;
+                if(b.d != 0.0)
+                    r.d += r.v * log(a.v) * b.d;
+                break;
+            case Program::OpMod: r.d = a.d - trunc(a.v / b.v) * b.d; break;
+            case Program::OpAtan2:
+                r.d = (b.v * a.d - a.v * b.d) / (a.v * a.v + b.v * b.v); break;
+            case Program::OpMin: r.d = b.v < a.v ? b.d : a.d; break;
+            case Program::OpMax: r.d = b.v > a.v ? b.d : a.d; break;
+            default: break; // Logical operators
+        }
+        return r;
+    }
+
+    // The stack machine
+    //--------------------------------------------------------------------------
+    template<class T>
+    bool Run(const vector<Program::Instruction> &code, T *vars, T *stack, T &result)
+    {
+        Program::size_type pc = 0, sp = 0;
+        while(pc < code.size())
+        {
+            const Program::Instruction &ins = code[pc++];
+            switch(ins.op)
+            {
+                case Program::OpConst:
+                    stack[sp++] = Make(ins.val, result);
+                    break;
+
+                case Program::OpLoad:
+                    stack[sp++] = vars[ins.arg];
+                    break;
+
+                case Program::OpStore:
+                    vars[ins.arg] = stack[sp - 1];
+                    break;
+
+                case Program::OpPop:
+                    --sp;
+                    break;
+
+                case Program::OpJump:
+                    pc = ins.arg;
+                    break;
+
+                case Program::OpJumpZero:
+                    if(Value(stack[--sp]) == 0.0)
+                        pc = ins.arg;
+                    break;
+
+                default:
+                    if(ins.op < Program::OpNeg)
+                    {
+                        --sp;
+                        stack[sp - 1] = Apply(ins.op, stack[sp - 1], stack[sp]);
+                    }
+                    else
+                        stack[sp - 1] = Apply(ins.op, stack[sp - 1]);
+
+                    // Domain errors, overflow and division by zero
+                    if(!Finite(stack[sp - 1]))
+                        return false;
+            }
+        }
+
+        result = stack[0];
+        return sp == 1;
+    }
+}
+
+// Program
+//------------------------------------------------------------------------------
+
+// Constructor
+Program::Program() : m_nargs(0), m_depth(0), m_maxDepth(0),
+        m_compiled(false), m_branching(false)
+{
+}
+
+// Register argument variable
+Program::size_type Program::AddArgument(double *var)
+{
+    m_vars.push_back(var);
+    m_init.push_back(0.0);
+    return m_nargs++;
+}
+
+// Compile expression
+bool Program::Compile(const Expression &expr)
+{
+    m_code.clear();
+    m_vars.resize(m_nargs);
+    m_init.resize(m_nargs);
+    m_depth = m_maxDepth = 0;
+
+    m_compiled = expr.Compile(*this) && m_depth == 1 && m_maxDepth <= MaxStack;
+    if(!m_compiled)
+        m_code.clear();
+
+    m_branching = false;
+    for(size_type pos = 0; pos < m_code.size(); pos++)
+    {
+        if(m_code[pos].op == OpJump || m_code[pos].op == OpJumpZero)
+            m_branching = true;
+    }
+
+    return m_compiled;
+}
+
+// Clear the program and all arguments
+void Program::Clear()
+{
+    m_code.clear();
+    m_vars.clear();
+    m_init.clear();
+    m_nargs = m_depth = m_maxDepth = 0;
+    m_compiled = m_branching = false;
+}
+
+// Check if an argument is referenced by the program
+bool Program::UsesArgument(size_type arg) const
+{
+    for(size_type pos = 0; pos < m_code.size(); pos++)
+    {
+        if(m_code[pos].op == OpLoad && m_code[pos].arg == arg)
+            return true;
+    }
+
+    return false;
+}
+
+// Evaluate
+bool Program::Evaluate(const double *args, double &result) const
+{
+    if(!m_compiled)
+        return false;
+
+    double vars[MaxSlots], stack[MaxStack];
+    for(size_type pos = 0; pos < m_vars.size(); pos++)
+        vars[pos] = pos < m_nargs ? args[pos] : m_init[pos];
+
+    return Run(m_code, vars, stack, result);
+}
+
+// Evaluate with derivative
+bool Program::Evaluate(const double *args, size_type darg,
+        double &result, double &deriv) const
+{
+    if(!m_compiled || darg >= m_nargs)
+        return false;
+
+    Dual vars[MaxSlots], stack[MaxStack], res = { 0.0, 0.0 };
+    for(size_type pos = 0; pos < m_vars.size(); pos++)
+    {
+        vars[pos].v = pos < m_nargs ? args[pos] : m_init[pos];
+        vars[pos].d = pos == darg ? 1.0 : 0.0;
+    }
+
+    if(!Run(m_code, vars, stack, res))
+        return false;
+
+    result = res.v;
+    deriv = res.d;
+    return true;
+}
+
+// Evaluate in a batch of points
+bool Program::Evaluate(size_type n, const double *const *args, double *result) const
+{
+    if(!m_compiled)
+        return false;
+
+    size_type i, k;
+    if(m_branching)
+    {
+        // Different points may take different branches, evaluate one by one
+        double x[MaxSlots];
+        for(i = 0; i < n; i++)
+        {
+            for(k = 0; k < m_nargs; k++)
+                x[k] = args[k][i];
+
+            if(!Evaluate(x, result[i]))
+                return false;
+        }
+
+        return true;
+    }
+
+    // Each variable and stack entry holds the values of one chunk of points
+    const size_type Chunk = 64;
+    vector<double> work((m_vars.size() + m_maxDepth) * Chunk);
+    double *vars = work.data();
+    double *stack = vars + m_vars.size() * Chunk;
+
+    for(size_type first = 0; first < n; first += Chunk)
+    {
+        size_type m = n - first < Chunk ? n - first : Chunk;
+
+        for(k = 0; k < m_vars.size(); k++)
+        {
+            double *v = vars + k * Chunk;
+            for(i = 0; i < m; i++)
+                v[i] = k < m_nargs ? args[k][first + i] : m_init[k];
+        }
+
+        double *top = stack - Chunk; // Top of the stack
+        for(size_type pc = 0; pc < m_code.size(); pc++)
+        {
+            const Instruction &ins = m_code[pc];
+            const double *a = top - Chunk; // Left operand of binary operators
+            switch(ins.op)
+            {
+                case OpConst:
+                    top += Chunk;
+                    for(i = 0; i < m; i++)
+                        top[i] = ins.val;
+                    continue;
+
+                case OpLoad:
+                    top += Chunk;
+                    copy(vars + ins.arg * Chunk, vars + ins.arg * Chunk + m, top);
+                    continue;
+
+                case OpStore:
+                    copy(top, top + m, vars + ins.arg * Chunk);
+                    continue;
+
+                case OpPop:
+                    top -= Chunk;
+                    continue;
+
+                case OpAdd:
+                    top -= Chunk;
+                    for(i = 0; i < m; i++)
+                        top[i] = a[i] + top[i + Chunk];
+                    continue;
+
+                case OpSub:
+                    top -= Chunk;
+                    for(i = 0; i < m; i++)
+                        top[i] = a[i] - top[i + Chunk];
+                    continue;
+
+                case OpMul:
+                    top -= Chunk;
+                    for(i = 0; i < m; i++)
+                        top[i] = a[i] * top[i + Chunk];
+                    continue;
+
+                case OpNeg:
+                    for(i = 0; i < m; i++)
+                        top[i] = -top[i];
+                    continue;
+
+                default:
+                    if(ins.op < OpNeg)
+                    {
+                        top -= Chunk;
+                        for(i = 0; i < m; i++)
+                            top[i] = Apply(ins.op, a[i], top[i + Chunk]);
+                    }
+                    else
+                    {
+                        for(i = 0; i < m; i++)
+                            top[i] = Apply(ins.op, top[i]);
+                    }
+            }
+
+            // Domain errors, overflow and division by zero
+            for(i = 0; i < m; i++)
+            {
+                if(!std::isfinite(top[i]))
+                    return false;
+            }
+        }
+
+        copy(stack, stack + m, result + first);
+    }
+
+    return true;
+}
+
+// Find or allocate the slot of a variable
+bool Program::GetSlot(double *var, size_type &slot)
+{
+    for(slot = 0; slot < m_vars.size(); slot++)
+    {
+        if(m_vars[slot] == var)
+            return true;
+    }
+
+    if(m_vars.size() >= MaxSlots)
+        return false;
+
+    // Non-argument variables start with their current value
+    m_vars.push_back(var);
+    m_init.push_back(*var);
+    return true;
+}
+
+// Add an instruction
+void Program::Emit(OpCode op, size_type arg, double val, int push)
+{
+    Instruction ins = { op, arg, val };
+    m_code.push_back(ins);
+
+    m_depth += push;
+    if(m_depth > m_maxDepth)
+        m_maxDepth = m_depth;
+}
+
+void Program::EmitConst(double val)
+{
+    Emit(OpConst, 0, val, 1);
+}
+
+bool Program::EmitLoad(double *var)
+{
+    size_type slot;
+    if(!GetSlot(var, slot))
+        return false;
+
+    Emit(OpLoad, slot, 0.0, 1);
+    return true;
+}
+
+bool Program::EmitStore(double *var)
+{
+    size_type slot;
+    if(!GetSlot(var, slot))
+        return false;
+
+    Emit(OpStore, slot, 0.0, 0);
+    return true;
+}
+
+void Program::EmitPop()
+{
+    Emit(OpPop, 0, 0.0, -1);
+}
+
+bool Program::EmitOperator(OpCode op)
+{
+    if(op <= OpJumpZero)
+        return false;
+
+    Emit(op, 0, 0.0, op < OpNeg ? -1 : 0);
+    return true;
+}
+
+// Add the instructions for a named function of nargs (compiled) arguments
+bool Program::EmitFunction(const string &name, size_type nargs)
+{
+    static const struct { const char *name; OpCode op; } unary[] = {
+        { "abs", OpAbs }, { "sqrt", OpSqrt }, { "sin", OpSin }, { "cos", OpCos },
+        { "tan", OpTan }, { "sinh", OpSinh }, { "cosh", OpCosh }, { "tanh", OpTanh },
+        { "asin", OpAsin }, { "acos", OpAcos }, { "atan", OpAtan }, { "log", OpLog },
+        { "ln", OpLn }, { "exp", OpExp }, { "floor", OpFloor }, { "ceil", OpCeil },
+        { "ipart", OpIpart }, { "fpart", OpFpart }, { "not", OpNot }
+    };
+    static const struct { const char *name; OpCode op; } binary[] = {
+        { "pow", OpPow }, { "mod", OpMod }, { "atan2", OpAtan2 },
+        { "min", OpMin }, { "max", OpMax }, { "equal", OpEqual },
+        { "above", OpAbove }, { "below", OpBelow }, { "and", OpAnd }, { "or", OpOr }
+    };
+
+    if(nargs == 1)
+    {
+        for(size_type i = 0; i < sizeof(unary) / sizeof(unary[0]); i++)
+        {
+            if(name == unary[i].name)
+                return EmitOperator(unary[i].op);
+        }
+
+        // Angle conversions
+        if(name == "deg" || name == "rad")
+        {
+            EmitConst(name == "deg" ? 180.0 / EXPREVAL_PI : EXPREVAL_PI / 180.0);
+            return EmitOperator(OpMul);
+        }
+    }
+    else if(nargs >= 2)
+    {
+        for(size_type i = 0; i < sizeof(binary) / sizeof(binary[0]); i++)
+        {
+            if(name != binary[i].name)
+                continue;
+
+            // Only min and max accept more than two arguments
+            if(nargs > 2 && binary[i].op != OpMin && binary[i].op != OpMax)
+                return false;
+
+            for(size_type n = 1; n < nargs; n++)
+                EmitOperator(binary[i].op);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Add a jump instruction, with target to be patched later
+Program::size_type Program::EmitJump(OpCode op)
+{
+    Emit(op, 0, 0.0, op == OpJumpZero ? -1 : 0);
+    return m_code.size() - 1;
+}
+
+// Let the jump at pos go to the next instruction to be added
+void Program::PatchJump(size_type pos)
+{
+    m_code[pos].arg = m_code.size();
+}
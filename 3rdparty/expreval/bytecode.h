@@ -0,0 +1,103 @@
+// File:    bytecode.h
+// Purpose: Compiled (flat bytecode) form of a parsed expression
+//------------------------------------------------------------------------------
+
+// ADDED to original code: The parsed node tree can be compiled into a flat
+// stack-machine program that is evaluated without touching the variables of
+// the value list. Evaluation is therefore stateless and thread-safe, and it
+// can also propagate the exact first derivative with respect to one of the
+// arguments (forward-mode automatic differentiation).
+
+#ifndef __EXPREVAL_BYTECODE_H
+#define __EXPREVAL_BYTECODE_H
+
+// Includes
+#include <string>
+#include <vector>
+
+// Part of expreval namespace
+namespace ExprEval
+{
+    // Forward declarations
+    class Expression;
+
+    // Compiled expression program
+    //--------------------------------------------------------------------------
+    class Program
+    {
+    public:
+        // Instruction set
+        enum OpCode
+        {
+            OpConst, OpLoad, OpStore, OpPop, OpJump, OpJumpZero,
+            OpAdd, OpSub, OpMul, OpDiv, OpPow, OpMod, OpAtan2,
+            OpMin, OpMax, OpEqual, OpAbove, OpBelow, OpAnd, OpOr,
+            OpNeg, OpNot, OpAbs, OpSqrt, OpSin, OpCos, OpTan,
+            OpSinh, OpCosh, OpTanh, OpAsin, OpAcos, OpAtan,
+            OpLog, OpLn, OpExp, OpFloor, OpCeil, OpIpart, OpFpart
+        };
+
+        // Single instruction
+        struct Instruction
+        {
+            OpCode op; // Operation
+            ::std::vector<double*>::size_type arg; // Slot or jump target
+            double val; // Constant value
+        };
+
+        typedef ::std::vector<Instruction>::size_type size_type;
+
+        // Upper limits on the number of variables and the stack depth
+        static const size_type MaxSlots = 64;
+        static const size_type MaxStack = 64;
+
+        Program();
+
+        // Register an argument variable (before compiling)
+        size_type AddArgument(double *var);
+
+        // Compile an expression, false if it contains unsupported items
+        bool Compile(const Expression &expr);
+        void Clear();
+
+        bool IsCompiled() const { return m_compiled; }
+        bool UsesArgument(size_type arg) const;
+
+        // Evaluate with the given argument values (thread-safe).
+        // Returns false if a math error occurred during evaluation.
+        bool Evaluate(const double *args, double &result) const;
+        // Evaluate also the derivative with respect to argument darg
+        bool Evaluate(const double *args, size_type darg,
+                double &result, double &deriv) const;
+        // Evaluate in n points, where args[i] points to the n values
+        // of argument i. The instructions are executed on chunks of points.
+        bool Evaluate(size_type n, const double *const *args, double *result) const;
+
+        // Code generation (used by the nodes when compiling)
+        void EmitConst(double val);
+        bool EmitLoad(double *var);
+        bool EmitStore(double *var);
+        void EmitPop();
+        bool EmitOperator(OpCode op);
+        bool EmitFunction(const ::std::string &name, size_type nargs);
+        size_type EmitJump(OpCode op);
+        void PatchJump(size_type pos);
+        void Unwind(size_type n) { m_depth -= n; }
+
+    private:
+        bool GetSlot(double *var, size_type &slot);
+        void Emit(OpCode op, size_type arg, double val, int push);
+
+        ::std::vector<Instruction> m_code; // Program instructions
+        ::std::vector<double*> m_vars; // Variable addresses, arguments first
+        ::std::vector<double> m_init; // Initial values of all variables
+        size_type m_nargs; // Number of argument variables
+        size_type m_depth; // Current stack depth during compilation
+        size_type m_maxDepth; // Maximum stack depth
+        bool m_compiled; // True if successfully compiled
+        bool m_branching; // True if the program contains jumps
+    };
+
+} // namespace ExprEval
+
+#endif // __EXPREVAL_BYTECODE_H
@@ -139,3 +139,9 @@ double Expression::Evaluate()
         throw(EmptyExpressionException());
     }
 }
+
+// Compile an expression
+bool Expression::Compile(Program &prog) const
+{
+    return m_expr && m_expr->Compile(prog);
+}
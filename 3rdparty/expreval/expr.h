@@ -17,6 +17,7 @@ namespace ExprEval
     class ValueList;
     class FunctionList;
     class Node;
+    class Program;
 
     // Expression class
     //--------------------------------------------------------------------------
@@ -48,6 +49,9 @@ namespace ExprEval
         // Evaluate expression
         double Evaluate();
 
+        // ADDED to original code: Compile expression into bytecode
+        bool Compile(Program &prog) const;
+
     protected:
         ValueList *m_vlist;
         FunctionList *m_flist;
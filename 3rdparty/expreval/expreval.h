@@ -13,6 +13,7 @@
 #include "node.h"
 #include "parser.h"
 #include "except.h"
+#include "bytecode.h"
 
 #endif // __EXPREVAL_EXPREVAL_H
 
@@ -16,6 +16,7 @@
 #include "vallist.h"
 #include "funclist.h"
 #include "except.h"
+#include "bytecode.h"
 
 using namespace std;
 using namespace ExprEval;
@@ -42,6 +43,12 @@ double Node::Evaluate()
     
     return DoEvaluate();
 }
+
+// Compile (not supported by default)
+bool Node::Compile(Program &) const
+{
+    return false;
+}
     
 // Function node
 //------------------------------------------------------------------------------
@@ -78,6 +85,45 @@ void FunctionNode::SetArgumentCount(long argMin, long argMax, long refMin, long
     m_refMin = refMin;
     m_refMax = refMax;
 }
+
+// Compile
+bool FunctionNode::Compile(Program &prog) const
+{
+    // Functions with reference parameters have side effects
+    if(!m_refs.empty())
+        return false;
+
+    vector<Node*>::size_type pos;
+    string name = GetName();
+
+    if(name == "if" && m_nodes.size() == 3)
+    {
+        // Evaluate only the selected branch
+        if(!m_nodes[0]->Compile(prog))
+            return false;
+
+        Program::size_type jfalse = prog.EmitJump(Program::OpJumpZero);
+        if(!m_nodes[1]->Compile(prog))
+            return false;
+
+        Program::size_type jend = prog.EmitJump(Program::OpJump);
+        prog.Unwind(1);
+        prog.PatchJump(jfalse);
+        if(!m_nodes[2]->Compile(prog))
+            return false;
+
+        prog.PatchJump(jend);
+        return true;
+    }
+
+    for(pos = 0; pos < m_nodes.size(); pos++)
+    {
+        if(!m_nodes[pos]->Compile(prog))
+            return false;
+    }
+
+    return prog.EmitFunction(name, m_nodes.size());
+}
     
 // Parse expression
 void FunctionNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -299,6 +345,26 @@ double MultiNode::DoEvaluate()
         
     return result;
 }
+
+// Compile
+bool MultiNode::Compile(Program &prog) const
+{
+    vector<Node*>::size_type pos;
+
+    for(pos = 0; pos < m_nodes.size(); pos++)
+    {
+        if(pos > 0)
+            prog.EmitPop();
+
+        if(!m_nodes[pos]->Compile(prog))
+            return false;
+    }
+
+    if(m_nodes.empty())
+        prog.EmitConst(0.0);
+
+    return true;
+}
     
 // Parse
 void MultiNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -408,6 +474,12 @@ double AssignNode::DoEvaluate()
 {
     return (*m_var = m_rhs->Evaluate());        
 }
+
+// Compile
+bool AssignNode::Compile(Program &prog) const
+{
+    return m_rhs->Compile(prog) && prog.EmitStore(m_var);
+}
     
 // Parse
 void AssignNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -496,6 +568,13 @@ double AddNode::DoEvaluate()
 {
     return m_lhs->Evaluate() + m_rhs->Evaluate();        
 }
+
+// Compile
+bool AddNode::Compile(Program &prog) const
+{
+    return m_lhs->Compile(prog) && m_rhs->Compile(prog) &&
+        prog.EmitOperator(Program::OpAdd);
+}
     
 // Parse
 void AddNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -540,6 +619,13 @@ double SubtractNode::DoEvaluate()
 {
     return m_lhs->Evaluate() - m_rhs->Evaluate();        
 }
+
+// Compile
+bool SubtractNode::Compile(Program &prog) const
+{
+    return m_lhs->Compile(prog) && m_rhs->Compile(prog) &&
+        prog.EmitOperator(Program::OpSub);
+}
     
 // Parse
 void SubtractNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -584,6 +670,13 @@ double MultiplyNode::DoEvaluate()
 {
     return m_lhs->Evaluate() * m_rhs->Evaluate();        
 }
+
+// Compile
+bool MultiplyNode::Compile(Program &prog) const
+{
+    return m_lhs->Compile(prog) && m_rhs->Compile(prog) &&
+        prog.EmitOperator(Program::OpMul);
+}
     
 // Parse
 void MultiplyNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -637,6 +730,13 @@ double DivideNode::DoEvaluate()
         throw(DivideByZeroException());
     }
 }
+
+// Compile
+bool DivideNode::Compile(Program &prog) const
+{
+    return m_lhs->Compile(prog) && m_rhs->Compile(prog) &&
+        prog.EmitOperator(Program::OpDiv);
+}
     
 // Parse
 void DivideNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -680,6 +780,12 @@ double NegateNode::DoEvaluate()
 {
     return -(m_rhs->Evaluate());        
 }
+
+// Compile
+bool NegateNode::Compile(Program &prog) const
+{
+    return m_rhs->Compile(prog) && prog.EmitOperator(Program::OpNeg);
+}
     
 // Parse
 void NegateNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -729,6 +835,13 @@ double ExponentNode::DoEvaluate()
         
     return result;        
 }
+
+// Compile
+bool ExponentNode::Compile(Program &prog) const
+{
+    return m_lhs->Compile(prog) && m_rhs->Compile(prog) &&
+        prog.EmitOperator(Program::OpPow);
+}
     
 // Parse
 void ExponentNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -770,6 +883,12 @@ double VariableNode::DoEvaluate()
 {
     return *m_var;        
 }
+
+// Compile
+bool VariableNode::Compile(Program &prog) const
+{
+    return prog.EmitLoad(m_var);
+}
     
 // Parse
 void VariableNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -840,6 +959,13 @@ double ValueNode::DoEvaluate()
 {
     return m_val;        
 }
+
+// Compile
+bool ValueNode::Compile(Program &prog) const
+{
+    prog.EmitConst(m_val);
+    return true;
+}
     
 // Parse
 void ValueNode::Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
@@ -18,6 +18,7 @@ namespace ExprEval
     // Forward declarations
     class Expression;
     class FunctionFactory;
+    class Program;
 
     
     // Node class
@@ -33,6 +34,9 @@ namespace ExprEval
                 Parser::size_type v1 = 0) = 0;
                 
         double Evaluate(); // Calls Expression::TestAbort, then DoEvaluate
+
+        // ADDED to original code: Compile into bytecode (false if unsupported)
+        virtual bool Compile(Program &prog) const;
         
     protected:
         Expression *m_expr;    
@@ -49,7 +53,9 @@ namespace ExprEval
         // Parse nodes and references
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
-                
+
+        // Compile by function name, built-in pure functions only
+        bool Compile(Program &prog) const;
                 
     private:
         // Function factory
@@ -87,6 +93,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         ::std::vector<Node*> m_nodes;
@@ -103,6 +110,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         double *m_var;
@@ -120,6 +128,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         Node *m_lhs;
@@ -137,6 +146,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         Node *m_lhs;
@@ -154,6 +164,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         Node *m_lhs;
@@ -171,6 +182,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         Node *m_lhs;
@@ -188,6 +200,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         Node *m_rhs;
@@ -204,6 +217,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         Node *m_lhs;
@@ -221,6 +235,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         double *m_var;
@@ -237,6 +252,7 @@ namespace ExprEval
         double DoEvaluate();
         void Parse(Parser &parser, Parser::size_type start, Parser::size_type end,
                 Parser::size_type v1 = 0);
+        bool Compile(Program &prog) const;
                 
     private:
         double m_val;
@@ -169,6 +169,20 @@ public:
     return S1.deSerialize(data) && S2.deSerialize(data);
   }
 
+  //! \brief Adds references to internal state arrays for restarting purposes.
+  //! \param data Container for typed restart data
+  bool serializeArrays(std::map<std::string,std::pair<double*,size_t>>& data)
+  {
+    return S1.serializeArrays(data) && S2.serializeArrays(data);
+  }
+
+  //! \brief Adds references to internal state arrays to restore on restart.
+  //! \param data Container for typed restart data
+  bool deSerializeArrays(std::map<std::string,std::pair<double*,size_t>>& data)
+  {
+    return S1.deSerializeArrays(data) && S2.deSerializeArrays(data);
+  }
+
 protected:
   T1& S1; //!< First substep
   T2& S2; //!< Second substep
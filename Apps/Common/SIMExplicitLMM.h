@@ -168,6 +168,20 @@ public:
     return solver.deSerialize(data);
   }
 
+  //! \brief Adds references to internal state arrays for restarting purposes.
+  //! \param data Container for typed restart data
+  bool serializeArrays(std::map<std::string,std::pair<double*,size_t>>& data)
+  {
+    return solver.serializeArrays(data);
+  }
+
+  //! \brief Adds references to internal state arrays to restore on restart.
+  //! \param data Container for typed restart data
+  bool deSerializeArrays(std::map<std::string,std::pair<double*,size_t>>& data)
+  {
+    return solver.deSerializeArrays(data);
+  }
+
   //! \brief Mark operator as linear to avoid repeated assembly and factorization.
   void setLinear(bool enable) { linear = enable; }
 
@@ -137,6 +137,10 @@ public:
         str << "_plane" << plane;
         HDF5Writer* hdf = new HDF5Writer(name+str.str(),
                                          m_planes[i]->getProcessAdm(),false);
+        if (IFEM::getOptions().hdf5compress > 0)
+          hdf->setCompression(IFEM::getOptions().hdf5compress);
+        if (IFEM::getOptions().hdf5async)
+          hdf->setAsync(true);
         exp->registerWriter(hdf);
         plane_exporters.push_back(exp);
         m_planes[i]->registerFields(*exp);
@@ -173,6 +177,12 @@ public:
   bool serialize(std::map<std::string,std::string>&) { return false; }
   //! \brief Dummy method, no deserialization support.
   bool deSerialize(const std::map<std::string,std::string>&) { return false; }
+  //! \brief Dummy method, no typed restart support.
+  bool serializeArrays(std::map<std::string,std::pair<double*,size_t>>&)
+  { return false; }
+  //! \brief Dummy method, no typed restart support.
+  bool deSerializeArrays(std::map<std::string,std::pair<double*,size_t>>&)
+  { return false; }
 
   //! \brief Solves the nonlinear equations by Newton-Raphson iterations.
   bool solveStep(TimeStep& tp)
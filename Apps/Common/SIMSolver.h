@@ -19,13 +19,14 @@
 #include "TimeStep.h"
 #include "HDF5Restart.h"
 #include "HDF5Writer.h"
+#include "VTUWriter.h"
 #include "tinyxml.h"
 
 
 /*!
   \brief Template class for stationary simulator drivers.
   \details This template can be instantiated over any type implementing the
-  ISolver interface. It provides data output to HDF5 and VTF.
+  ISolver interface. It provides data output to HDF5, VTU and VTF.
 */
 
 template<class T1> class SIMSolverStat : public SIMadmin
@@ -47,6 +48,8 @@ public:
   //! \param[in] hdf5file The file to save to
   //! \param[in] modelAdm Process administrator to use
   //! \param[in] saveInterval The stride in the output file
+  //!
+  //! \details VTU output is added if requested through the options.
   void handleDataOutput(const std::string& hdf5file,
                         const ProcessAdm& modelAdm,
                         int saveInterval = 1)
@@ -57,7 +60,19 @@ public:
     else
     {
       exporter = new DataExporter(true,saveInterval);
-      exporter->registerWriter(new HDF5Writer(hdf5file,modelAdm));
+      if (!hdf5file.empty())
+      {
+        const SIMoptions& opt = IFEM::getOptions();
+        HDF5Writer* hdf = new HDF5Writer(hdf5file,modelAdm);
+        if (opt.hdf5compress > 0)
+          hdf->setCompression(opt.hdf5compress);
+        if (opt.hdf5async)
+          hdf->setAsync(true);
+        exporter->registerWriter(hdf);
+      }
+      if (!IFEM::getOptions().vtu.empty())
+        exporter->registerWriter(new VTUWriter(IFEM::getOptions().vtu,
+                                               modelAdm));
       S1.registerFields(*exporter);
       IFEM::registerCallback(*exporter);
     }
@@ -174,7 +189,7 @@ public:
                         int saveInterval = 1,
                         int restartInterval = 0)
   {
-    if (restartInterval > 0)
+    if (restartInterval > 0 && !hdf5file.empty())
       restartAdm = new HDF5Restart(hdf5file+"_restart",modelAdm,restartInterval);
 
     this->SIMSolverStat<T1>::handleDataOutput(hdf5file, modelAdm, saveInterval);
@@ -194,6 +209,22 @@ public:
     return tp.deSerialize(data) && this->S1.deSerialize(data);
   }
 
+  //! \brief Adds references to internal state arrays for restarting purposes.
+  //! \param data Container for typed restart data
+  //!
+  //! \details The time stepping information is written by HDF5Restart.
+  bool serialize(HDF5Restart::ArrayData& data)
+  {
+    return this->S1.serializeArrays(data);
+  }
+
+  //! \brief Adds references to internal state arrays to restore on restart.
+  //! \param data Container for typed restart data
+  bool deSerialize(HDF5Restart::ArrayData& data)
+  {
+    return this->S1.deSerializeArrays(data);
+  }
+
 protected:
   //! \brief Parses a data section from an input stream.
   virtual bool parse(char* keyw, std::istream& is) { return tp.parse(keyw,is); }
@@ -223,10 +254,20 @@ protected:
       return false;
 
     if (saveRes && SIMSolverStat<T1>::exporter) {
-      HDF5Restart::SerializeData data;
-      if (restartAdm && restartAdm->dumpStep(tp) && this->serialize(data))
-        if (!restartAdm->writeData(tp,data))
-          return false;
+      if (restartAdm && restartAdm->dumpStep(tp)) {
+        // Wait for pending asynchronous result output before writing restart
+        SIMSolverStat<T1>::exporter->sync();
+        // Use the typed format if supported, otherwise the serialized format
+        HDF5Restart::ArrayData arrays;
+        HDF5Restart::SerializeData data;
+        if (this->serialize(arrays)) {
+          if (!restartAdm->writeData(tp,arrays))
+            return false;
+        }
+        else if (this->serialize(data))
+          if (!restartAdm->writeData(tp,data))
+            return false;
+      }
 
       return SIMSolverStat<T1>::exporter->dumpTimeLevel(&tp,newMesh);
     }
@@ -244,17 +285,37 @@ public:
   {
     if (restartFile.empty()) return 0;
 
-    HDF5Restart::SerializeData data;
+    if (SIMSolverStat<T1>::exporter)
+      SIMSolverStat<T1>::exporter->sync();
+
     HDF5Restart hdf(restartFile,SIMadmin::adm,1);
-    if ((restartStep = hdf.readData(data,restartStep)) >= 0)
+    if (hdf.hasArrayData(restartStep))
     {
-      IFEM::cout <<"\n === Restarting from a serialized state ==="
-                 <<"\n     file = "<< restartFile
-                 <<"\n     step = "<< restartStep << std::endl;
-      if (this->deSerialize(data))
-        return restartStep+1;
-      else
+      // The typed arrays are read directly into the solver state
+      HDF5Restart::ArrayData arrays;
+      if (!this->deSerialize(arrays))
         restartStep = -2;
+      else if ((restartStep = hdf.readData(arrays,restartStep,&tp)) >= 0)
+      {
+        IFEM::cout <<"\n === Restarting from a typed state ==="
+                   <<"\n     file = "<< restartFile
+                   <<"\n     step = "<< restartStep << std::endl;
+        return restartStep+1;
+      }
+    }
+    else
+    {
+      HDF5Restart::SerializeData data;
+      if ((restartStep = hdf.readData(data,restartStep)) >= 0)
+      {
+        IFEM::cout <<"\n === Restarting from a serialized state ==="
+                   <<"\n     file = "<< restartFile
+                   <<"\n     step = "<< restartStep << std::endl;
+        if (this->deSerialize(data))
+          return restartStep+1;
+        else
+          restartStep = -2;
+      }
     }
 
     std::cerr <<" *** SIMSolver: Failed to read restart data."<< std::endl;
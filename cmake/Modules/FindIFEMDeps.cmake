@@ -161,7 +161,8 @@ IF(IFEM_USE_HDF5)
   endif()
   find_package(HDF5 COMPONENTS C)
   if(HDF5_FOUND)
-    SET(IFEM_DEPLIBS ${IFEM_DEPLIBS} ${HDF5_LIBRARIES})
+    FIND_PACKAGE(Threads REQUIRED) # for the asynchronous HDF5Writer
+    SET(IFEM_DEPLIBS ${IFEM_DEPLIBS} ${HDF5_LIBRARIES} ${CMAKE_THREAD_LIBS_INIT})
     set(IFEM_DEPINCLUDES ${IFEM_DEPINCLUDES} ${HDF5_INCLUDE_DIR}
                          ${HDF5_INCLUDE_DIRS})
     SET(IFEM_BUILD_CXX_FLAGS "${IFEM_BUILD_CXX_FLAGS} -DHAS_HDF5=1")
@@ -173,6 +173,10 @@ public:
   //! \brief Resets the global element and node counters.
   static void resetNumbering(int n = 0);
 
+  //! \brief Sets the memory budget for the cached Gauss point tables.
+  //! \param[in] size Memory budget (in MB) shared by all patches
+  static void setGaussPointTableSize(double size);
+
 
   // Service methods for query of various model data
   // ===============================================
@@ -492,6 +496,10 @@ public:
   //! \param[in] param The parameters of the point in the knot-span domain
   //! \return Local element number within the patch that contains the point
   virtual int findElementContaining(const double* param) const = 0;
+  //! \brief Finds the parameters of a spatial point within an element.
+  //! \return Distance between the given point and the projected point,
+  //! negative if point inversion is not supported for this patch type
+  virtual double findPoint(Vec3&, int, double*) const { return -1.0; }
 
   //! \brief Creates a standard FE model of this patch for visualization.
   //! \param[out] grid The generated finite element grid
@@ -394,6 +394,12 @@ protected:
   //! \param[out] u Parameter values of the element borders
   virtual void getElementBorders(int iel, double* u) const;
 
+  //! \brief Evaluates the geometry and its parameter derivatives at a point.
+  //! \param[in] param Parameters of the point in the knot-span domain
+  //! \param[out] X Cartesian coordinates of the point
+  //! \param[out] dXdu Derivatives of \a X with respect to each parameter
+  virtual bool evalGeometry(const double* param, Vec3& X, Vec3* dXdu) const;
+
   //! \brief Computes the element end coordinates.
   //! \param[in] i Parameter index for the knot-span element
   //! \param[out] XC Coordinates of the element corners
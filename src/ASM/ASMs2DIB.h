@@ -104,6 +104,12 @@ public:
   //! \param[in] grid The visualization grid
   virtual void filterResults(Matrix& field, const ElementBlock* grid) const;
 
+protected:
+  //! \brief Returns the estimated work load of an element.
+  //! \details The load is estimated from the number of quadrature points,
+  //! such that the intersected elements are weighted by their sub-cells.
+  virtual double getElementLoad(size_t iel) const;
+
 private:
   Immersed::Geometry* myGeometry; //!< The physical geometry description
   ElementBlock*       myLines;    //!< Sub-cell grid lines (for plotting)
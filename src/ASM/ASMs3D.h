@@ -18,6 +18,7 @@
 #include "ASM3D.h"
 #include "Interface.h"
 #include "ThreadGroups.h"
+#include "GaussPointTable.h"
 
 namespace utl {
   class Point;
@@ -644,6 +645,12 @@ protected:
   //! \param[out] u Parameter values of the element borders
   virtual void getElementBorders(int iel, double* u) const;
 
+  //! \brief Evaluates the geometry and its parameter derivatives at a point.
+  //! \param[in] param Parameters of the point in the knot-span domain
+  //! \param[out] X Cartesian coordinates of the point
+  //! \param[out] dXdu Derivatives of \a X with respect to each parameter
+  virtual bool evalGeometry(const double* param, Vec3& X, Vec3* dXdu) const;
+
   //! \brief Computes the element border parameters.
   //! \param[in] i1 Parameter index in u-direction
   //! \param[in] i2 Parameter index in v-direction
@@ -695,6 +702,11 @@ protected:
   //! \brief Generates element groups from a partition.
   virtual void generateThreadGroupsFromElms(const IntVec& elms);
 
+  //! \brief Returns the estimated work load of an element.
+  //! \param[in] iel 0-based element index
+  //! \details Used to balance the element tasks of the threading groups.
+  virtual double getElementLoad(size_t iel) const;
+
 public:
   //! \brief Auxilliary function for computation of basis function indices.
   static void scatterInd(int n1, int n2, int n3, int p1, int p2, int p3,
@@ -815,6 +827,9 @@ protected:
   ThreadGroups                threadGroupsVol;
   //! Element groups for multi-threaded face assembly
   std::map<char,ThreadGroups> threadGroupsFace;
+
+  //! Cached basis functions and geometry mapping at the Gauss points
+  GaussPointTable gpTable;
 };
 
 #endif
@@ -130,6 +130,8 @@ public:
   //! \param[out] X The Cartesian coordinates of the point
   //! \return Local node number within the patch that is closest to the point
   virtual int evalPoint(const double* xi, double* param, Vec3& X) const;
+  //! \brief Point inversion is not supported for Lagrange patches.
+  virtual double findPoint(Vec3&, int, double*) const { return -1.0; }
 
   //! \brief Creates a hexahedron element model of this patch for visualization.
   //! \param[out] grid The generated hexahedron grid
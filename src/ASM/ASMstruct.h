@@ -106,6 +106,24 @@ protected:
   //! \param[out] u Parameter values of the element borders
   virtual void getElementBorders(int iel, double* u) const = 0;
 
+  //! \brief Evaluates the geometry and its parameter derivatives at a point.
+  //! \param[in] param Parameters of the point in the knot-span domain
+  //! \param[out] X Cartesian coordinates of the point
+  //! \param[out] dXdu Derivatives of \a X with respect to each parameter
+  virtual bool evalGeometry(const double* param, Vec3& X,
+                            Vec3* dXdu) const = 0;
+
+public:
+  //! \brief Finds the parameters of a spatial point within an element.
+  //! \param X Cartesian coordinates of the point, projected point on output
+  //! \param[in] iel 1-based index of the element to search within
+  //! \param[out] param Parameters of the point in the knot-span domain
+  //! \return Distance between the given point and the projected point
+  //!
+  //! \details The point is inverted by Gauss-Newton iterations starting at
+  //! the element center, with the parameters restricted to the element.
+  virtual double findPoint(Vec3& X, int iel, double* param) const;
+
 protected:
   Go::GeomObject* geomB; //!< Pointer to spline object of the geometry basis
   Go::GeomObject* projB; //!< Pointer to spline object of the projection basis
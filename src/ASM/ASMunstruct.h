@@ -22,6 +22,7 @@ typedef std::vector<int> IntVec; //!< General integer vector
 typedef std::set<int>    IntSet; //!< General integer set
 
 class RealFunc;
+class Integrand;
 
 
 namespace LR //! Utilities for LR-splines.
@@ -93,6 +94,15 @@ public:
   //! \param[in] fName Prefix for file names
   //! \param[in] fType Flag telling which file type(s) to write (15 means all)
   virtual void storeMesh(const std::string& fName, int fType = 15) const {}
+
+  //! \brief Enables caching of interior element matrices between refinements.
+  //! \param[in] integrand The integrand to cache element matrices for,
+  //! a null pointer disables (and clears) the cache
+  //!
+  //! \details When enabled, the interior element matrices of the given
+  //! integrand are retained after the assembly, and only the elements that
+  //! are new or modified by a subsequent mesh refinement are integrated again.
+  virtual void reuseElementMatrices(const Integrand* integrand) {}
 };
 
 #endif
@@ -58,6 +58,10 @@ public:
 
   //! \brief Initializes the system matrices to zero.
   //! \param[in] initLHS If \e false, only initialize right-hand-side vectors
+  //!
+  //! \details If \a initLHS is \e false, the system matrices are left
+  //! untouched by the subsequent element assembly, such that a previously
+  //! factorized matrix can be re-used by the linear equation solver.
   virtual void initialize(bool initLHS);
   //! \brief Finalizes the system matrices after element assembly.
   //! \param[in] newLHS If \e false, only right-hand-side vectors was assembled
@@ -97,6 +101,7 @@ private:
   std::vector<double>        c; //!< Global scalar quantities
   std::vector<double>*       d; //!< Multithreading buffer for the scalar values
   Vector                     R; //!< Nodal reaction forces
+  bool                  newLHS; //!< If \e false, only assemble the RHS-vectors
 
   const SAM&        sam; //!< Data for FE assembly management
   const ProcessAdm* adm; //!< Parallel process administrator
@@ -34,10 +34,33 @@ class ElmMats : public LocalIntegral
 {
 public:
   //! \brief Default constructor.
-  explicit ElmMats(bool lhs = true) : rhsOnly(false), withLHS(lhs) {}
+  explicit ElmMats(bool lhs = true) : rhsOnly(false), withLHS(lhs),
+                                      cached(false), inUse(false) {}
+  //! \brief Copy constructor.
+  //! \details The copy is never owned by an ElmMatsCache, even if \a elm is.
+  ElmMats(const ElmMats& elm) : LocalIntegral(elm), A(elm.A), b(elm.b),
+                                c(elm.c), rhsOnly(elm.rhsOnly),
+                                withLHS(elm.withLHS),
+                                cached(false), inUse(false) {}
   //! \brief Empty destructor.
   virtual ~ElmMats() {}
 
+  //! \brief Assignment operator.
+  //! \details The cache ownership of \a *this is not changed.
+  ElmMats& operator=(const ElmMats& elm)
+  {
+    A = elm.A;
+    b = elm.b;
+    c = elm.c;
+    rhsOnly = elm.rhsOnly;
+    withLHS = elm.withLHS;
+    return *this;
+  }
+
+  //! \brief Virtual destruction method to clean up after numerical integration.
+  //! \details Objects owned by an ElmMatsCache are only released for reuse.
+  virtual void destruct() { if (cached) inUse = false; else delete this; }
+
   //! \brief Defines the number of element matrices and vectors.
   //! \param[in] nA Number of element matrices
   //! \param[in] nB Number of element vectors
@@ -46,7 +69,9 @@ public:
 
   //! \brief Sets the dimension of the element matrices and vectors.
   //! \param[in] ndim Number of rows and columns in the matrices/vectors
-  void redim(size_t ndim);
+  //! \param[in] forceClear If \e true, zero the content also if the
+  //! dimension is unchanged
+  void redim(size_t ndim, bool forceClear = false);
 
   //! \brief Checks if the element matrices are empty.
   virtual bool empty() const { return A.empty() && b.empty(); }
@@ -64,6 +89,46 @@ public:
 
   bool rhsOnly; //!< If \e true, only the right-hand-sides are assembled
   bool withLHS; //!< If \e true, left-hand-side element matrices are present
+
+private:
+  bool cached; //!< If \e true, this object is owned by an ElmMatsCache
+  bool inUse;  //!< If \e true, this cached object is currently in use
+
+  friend class ElmMatsCache;
+};
+
+
+/*!
+  \brief Per-thread cache of element matrix objects.
+  \details The cache keeps one interior and one boundary ElmMats object for
+  each thread, such that these can be reused for all elements of the patch,
+  instead of allocating new objects and element matrices for each element.
+  The cached objects are released for reuse when their \a destruct method is
+  invoked. Copying a cache yields an empty cache, since each integrand object
+  needs its own set of element matrices.
+*/
+
+class ElmMatsCache
+{
+public:
+  //! \brief The constructor allocates one slot for each available thread.
+  ElmMatsCache();
+  //! \brief The copy constructor creates an empty cache.
+  ElmMatsCache(const ElmMatsCache&) : ElmMatsCache() {}
+  //! \brief The destructor deletes the cached objects.
+  ~ElmMatsCache();
+
+  //! \brief Assignment operator, the cache content is not copied.
+  ElmMatsCache& operator=(const ElmMatsCache&) { return *this; }
+
+  //! \brief Returns an unused element matrix object for the calling thread.
+  //! \param[in] neumann If \e true, return the boundary integral object
+  //! \return Null pointer if no object is available, the caller should then
+  //! allocate a new (non-cached) object instead
+  ElmMats* get(bool neumann);
+
+private:
+  std::vector<ElmMats*> elms; //!< Cached objects, two for each thread
 };
 
 #endif
@@ -0,0 +1,114 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ElmMatsTable.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Cache of element matrices surviving adaptive mesh refinements.
+//!
+//==============================================================================
+
+#ifndef _ELM_MATS_TABLE_H
+#define _ELM_MATS_TABLE_H
+
+#include "MatVec.h"
+#include <map>
+
+class ElmMats;
+
+typedef std::vector<int> IntVec; //!< General integer vector
+
+
+/*!
+  \brief Cache of element matrices surviving adaptive mesh refinements.
+  \details The table stores the interior element matrices and vectors of the
+  last assembly of a patch, together with the identity of each element.
+  The element identity consists of a key, typically the parametric bounds of
+  the element, and a signature for each basis function with support on it.
+  When the patch is assembled again after a mesh refinement, elements with
+  a matching key and the same set of basis functions (possibly in another
+  order) are recognized as unmodified, and their element matrices can then
+  be fetched from the table instead of being integrated once more.
+
+  The table is opt-in, and is only used for the integrand it is owned by.
+  It is the responsibility of the owner to ensure that the element matrices
+  of unmodified elements indeed are unchanged between the assemblies, which
+  normally only is the case for linear problems. Copying a table yields an
+  empty table.
+*/
+
+class ElmMatsTable
+{
+  //! \brief Cached data of an element.
+  struct Entry
+  {
+    RealArray key;               //!< Element key
+    std::vector<RealArray> func; //!< Basis function signatures
+    std::vector<Matrix> A;       //!< Element matrices
+    std::vector<Vector> b;       //!< Element vectors
+    RealArray c;                 //!< Element scalar quantities
+    bool stored = false;         //!< If \e true, the matrices are stored
+  };
+
+public:
+  //! \brief Default constructor.
+  ElmMatsTable() : owner(nullptr) {}
+  //! \brief The copy constructor creates an empty table.
+  ElmMatsTable(const ElmMatsTable&) : ElmMatsTable() {}
+
+  //! \brief The assignment operator leaves this table empty.
+  ElmMatsTable& operator=(const ElmMatsTable&) { this->clear(); return *this; }
+
+  //! \brief Defines the owner of the table, a null pointer disables it.
+  //! \details The table is cleared if the owner is changed.
+  void setOwner(const void* owner);
+  //! \brief Checks if the table is enabled and owned by the given object.
+  bool isOwner(const void* obj) const { return owner && owner == obj; }
+
+  //! \brief Releases all cached element matrices.
+  void clear();
+
+  //! \brief Starts a new assembly pass over the patch.
+  //! \param[in] nel Number of elements in the patch
+  //! \details The element matrices stored during the previous pass are
+  //! retained for lookup until end() is invoked.
+  void begin(size_t nel);
+  //! \brief Defines the identity of an element in the current pass.
+  //! \param[in] iel Zero-based element index
+  //! \param[in] key Element key
+  //! \param[in] func Signatures of the basis functions of the element
+  //! \param[out] perm Index of each basis function in the cached element
+  //! \return Index of the matching cached element, -1 if no match
+  int insert(size_t iel, RealArray& key, std::vector<RealArray>& func,
+             IntVec& perm);
+  //! \brief Fetches the element matrices of a cached element.
+  //! \param[in] idx Index of the cached element, as returned by insert()
+  //! \param[in] perm Index of each basis function in the cached element
+  //! \param[out] elm The element matrices to receive the cached data
+  //! \return \e false if the cached matrices are incompatible with \a elm
+  //!
+  //! \details The cached entry is released after it has been fetched.
+  bool fetch(int idx, const IntVec& perm, ElmMats& elm);
+  //! \brief Stores the element matrices of an element in the current pass.
+  //! \param[in] iel Zero-based element index
+  //! \param[in] elm The element matrices to store
+  void store(size_t iel, const ElmMats& elm);
+  //! \brief Ends the current assembly pass.
+  //! \details The element matrices of the previous pass are released.
+  void end();
+
+  //! \brief Returns the number of elements stored in the current pass.
+  size_t size() const;
+
+private:
+  const void* owner; //!< The object owning the table
+
+  std::vector<Entry> current;  //!< Elements of the current assembly pass
+  std::vector<Entry> previous; //!< Elements of the previous assembly pass
+  std::map<RealArray,int> keys; //!< Element key to index in \a previous
+};
+
+#endif
@@ -0,0 +1,104 @@
+// $Id$
+//==============================================================================
+//!
+//! \file GaussPointTable.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Cache of basis function values and geometry mapping at Gauss points.
+//!
+//==============================================================================
+
+#ifndef _GAUSS_POINT_TABLE_H
+#define _GAUSS_POINT_TABLE_H
+
+#include "MatVec.h"
+
+class Vec3;
+
+
+/*!
+  \brief Cache of basis function values and geometry mapping at Gauss points.
+  \details The table stores the basis function values, the Cartesian basis
+  function gradients, the Jacobian matrix, the weighted Jacobian determinant
+  and the Cartesian coordinates of all interior integration points of a patch.
+  It is filled during the first assembly after the table has been initialized,
+  and is then used by subsequent assemblies to skip the basis function
+  evaluation and the geometry mapping entirely.
+
+  The table is opt-in, and is only created if its size fits within the global
+  memory budget #maxMemory, which is shared by all patches of the model.
+  The owning patch must invoke clear() whenever the geometry, the basis or the
+  quadrature changes. Copying a table yields an empty table.
+*/
+
+class GaussPointTable
+{
+public:
+  //! \brief Default constructor.
+  GaussPointTable() : nen(0), nsd(0), ndim(0), complete(false) {}
+  //! \brief The copy constructor creates an empty table.
+  GaussPointTable(const GaussPointTable&) : GaussPointTable() {}
+  //! \brief The destructor releases the memory of the table.
+  ~GaussPointTable() { this->clear(); }
+
+  //! \brief The assignment operator leaves this table empty.
+  GaussPointTable& operator=(const GaussPointTable&) { this->clear(); return *this; }
+
+  //! \brief Allocates the table for the given dimensions.
+  //! \param[in] nGP Total number of integration points in the patch
+  //! \param[in] n_en Number of basis functions per element
+  //! \param[in] n_sd Number of spatial dimensions
+  //! \param[in] n_dim Number of parametric dimensions
+  //! \return \e false if the table is not used, either since it is disabled
+  //! or since it would exceed the memory budget
+  //!
+  //! \details If the table is already allocated with the same dimensions,
+  //! its content is retained. Otherwise it is reallocated and has to be
+  //! filled again.
+  bool init(size_t nGP, size_t n_en, size_t n_sd, size_t n_dim);
+  //! \brief Releases the table and its share of the memory budget.
+  void clear();
+
+  //! \brief Returns \e true if all integration points have been stored.
+  bool isComplete() const { return complete; }
+  //! \brief Marks the table as completely filled.
+  void setComplete() { complete = !data.empty(); }
+
+  //! \brief Stores the data of an integration point.
+  //! \param[in] ip Zero-based patch-level integration point index
+  //! \param[in] detJxW Weighted determinant of the Jacobian
+  //! \param[in] N Basis function values
+  //! \param[in] dNdX Cartesian basis function gradients
+  //! \param[in] Jac The Jacobian matrix
+  //! \param[in] X Cartesian coordinates of the integration point
+  void store(size_t ip, double detJxW, const Vector& N, const Matrix& dNdX,
+             const Matrix& Jac, const Vec3& X);
+  //! \brief Fetches the data of an integration point.
+  //! \param[in] ip Zero-based patch-level integration point index
+  //! \param[out] N Basis function values
+  //! \param[out] dNdX Cartesian basis function gradients
+  //! \param[out] Jac The Jacobian matrix
+  //! \param[out] X Cartesian coordinates of the integration point
+  //! \return Weighted determinant of the Jacobian (zero for singular points)
+  double fetch(size_t ip, Vector& N, Matrix& dNdX, Matrix& Jac, Vec3& X) const;
+
+  //! \brief Returns the memory currently used by all tables (in bytes).
+  static size_t usedMemory() { return totalSize; }
+
+  static size_t maxMemory; //!< Memory budget (in bytes) for all tables
+
+private:
+  size_t nen;  //!< Number of basis functions per element
+  size_t nsd;  //!< Number of spatial dimensions
+  size_t ndim; //!< Number of parametric dimensions
+  bool complete; //!< If \e true, all integration points have been stored
+
+  RealArray data; //!< Integration point data, stored point by point
+
+  static size_t totalSize; //!< Memory used by all tables (in bytes)
+};
+
+#endif
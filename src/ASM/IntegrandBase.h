@@ -15,6 +15,7 @@
 #define _INTEGRAND_BASE_H
 
 #include "Integrand.h"
+#include "ElmMats.h"
 #include "SIMenums.h"
 #include "ASMenums.h"
 #include "LinAlgenums.h"
@@ -84,6 +85,15 @@ public:
   //! \brief Returns the system quantity to be integrated by \a *this.
   virtual GlobalIntegral& getGlobalInt(GlobalIntegral* gq) const;
 
+  //! \brief Returns a copy of this integrand for concurrent patch assembly.
+  //! \details The default implementation returns \e nullptr, implying that
+  //! the patches are assembled one by one using this integrand only.
+  //! Sub-classes that reimplement this method must ensure that the copy
+  //! shares all patch-independent data (materials, loads, etc.) with \a *this,
+  //! and that no integration point data needs to persist in the copy.
+  //! The caller is responsible for deleting the returned object.
+  virtual IntegrandBase* getThreadCopy() const { return nullptr; }
+
 
   // Element-level initialization interface
   // ======================================
@@ -301,6 +311,7 @@ public:
 
 private:
   std::map<std::string,Vector*> myFields; //!< Named fields of this integrand
+  mutable ElmMatsCache myElmMats; //!< Reusable element matrices for each thread
 
 protected:
   unsigned short int nsd;     //!< Number of spatial dimensions (1, 2 or 3)
@@ -16,6 +16,7 @@
 
 #include "ASMbase.h"
 #include "ASMunstruct.h"
+#include "ElmMatsTable.h"
 #include "GoTools/geometry/BsplineBasis.h"
 
 class ThreadGroups;
@@ -24,6 +25,7 @@ class ThreadGroups;
 namespace LR //! Utilities for LR-splines.
 {
   class Basisfunction;
+  class Element;
   class LRSpline;
 
   //! \brief Expands the basis coefficients of an LR-spline object.
@@ -175,6 +177,9 @@ public:
   //! \brief Finds the node that is closest to the given point \b X.
   virtual std::pair<size_t,double> findClosestNode(const Vec3& X) const;
 
+  //! \brief Enables caching of interior element matrices between refinements.
+  virtual void reuseElementMatrices(const Integrand* integrand);
+
 protected:
   //! \brief Refines the mesh adaptively.
   //! \param[in] prm Input data used to control the mesh refinement
@@ -193,7 +198,25 @@ protected:
   //! \param groups The generated thread groups
   static void analyzeThreadGroups(const IntMat& groups);
 
+  //! \brief Initializes the element matrix cache for an assembly pass.
+  //! \param[in] integrand Object with problem-specific data and methods
+  //! \param[in] lr The LR-spline basis the elements are defined on
+  //! \param[out] reuse Index of the cached matrices of each element, or -1
+  //! \param[out] perm Basis function permutation for each reused element
+  //! \return \e false if the cache is not used for this integrand
+  bool initElementMatrices(const Integrand& integrand, const LR::LRSpline* lr,
+                           IntVec& reuse, IntMat& perm);
+  //! \brief Returns the identity of an element and its basis functions.
+  //! \param[in] el The element to identify
+  //! \param[out] key The parametric bounds of the element
+  //! \param[out] func Knot vectors, scaling weight and coefficients of each
+  //! basis function with support on the element
+  void getElementSignature(const LR::Element* el, RealArray& key,
+                           std::vector<RealArray>& func) const;
+
   LR::LRSpline* geo; //!< Pointer to the actual spline geometry object
+
+  ElmMatsTable elmTable; //!< Cached interior element matrices
 };
 
 #endif
@@ -128,9 +128,10 @@ public:
   //! \param B Right-hand-side vector on input, solution vector on output
   //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
   virtual bool solve(SystemVector& B, bool, Real* rc = nullptr);
-  //! \brief Solves the linear system of equations for a given right-hand-side.
+  //! \brief Solves the linear system of equations for a block of right-hand-sides.
   //! \param B Right-hand-side matrix on input, solution matrix on output
-  bool solve(Matrix& B);
+  //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
+  virtual bool solve(Matrix& B, bool = true, Real* rc = nullptr);
 
   //! \brief Solves a standard symmetric-definite eigenproblem.
   //! \details The eigenproblem is assumed to be on the form
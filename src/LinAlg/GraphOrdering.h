@@ -0,0 +1,84 @@
+// $Id$
+//==============================================================================
+//!
+//! \file GraphOrdering.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Bandwidth- and fill-reducing orderings of sparse graphs.
+//!
+//==============================================================================
+
+#ifndef _GRAPH_ORDERING_H
+#define _GRAPH_ORDERING_H
+
+#include <vector>
+#include <cstddef>
+
+typedef std::vector<int> IntVec; //!< General integer vector
+
+
+/*!
+  \brief Orderings of the vertices of an undirected sparse graph.
+  \details The graph is given in compressed adjacency format, where the
+  neighbors of vertex \a i are adj[xadj[i]],...,adj[xadj[i+1]-1], using
+  zero-based vertex indices. The adjacency must be symmetric and without
+  self-loops. The orderings are returned as permutation vectors, where
+  perm[k] is the vertex placed at position \a k in the new order.
+
+  The weight of a vertex is the number of unknowns associated with it,
+  such that the statistics refer to the resulting equation system.
+*/
+
+namespace GraphOrdering
+{
+  //! \brief Reverse Cuthill-McKee ordering, reducing the bandwidth.
+  //! \param[in] xadj Start index of each vertex in \a adj
+  //! \param[in] adj Neighbors of each vertex
+  //! \param[out] perm The vertex permutation
+  void RCM(const IntVec& xadj, const IntVec& adj, IntVec& perm);
+
+  //! \brief Approximate minimum degree ordering, reducing the fill-in.
+  //! \param[in] xadj Start index of each vertex in \a adj
+  //! \param[in] adj Neighbors of each vertex
+  //! \param[out] perm The vertex permutation
+  //!
+  //! \details The elimination is performed on a quotient graph, and the
+  //! vertex degrees are approximated by upper bounds as in the AMD algorithm
+  //! by Amestoy, Davis and Duff, but without supervariable detection.
+  void AMD(const IntVec& xadj, const IntVec& adj, IntVec& perm);
+
+  //! \brief Nested dissection ordering, reducing the fill-in.
+  //! \param[in] xadj Start index of each vertex in \a adj
+  //! \param[in] adj Neighbors of each vertex
+  //! \param[out] perm The vertex permutation
+  //! \param[in] minSize Subgraphs smaller than this are ordered by AMD
+  //!
+  //! \details The graph is recursively bisected by the middle level of a
+  //! rooted level structure, and the separators are numbered last.
+  void ND(const IntVec& xadj, const IntVec& adj, IntVec& perm,
+          int minSize = 64);
+
+  //! \brief Returns the (half) bandwidth of the graph in a given ordering.
+  //! \param[in] xadj Start index of each vertex in \a adj
+  //! \param[in] adj Neighbors of each vertex
+  //! \param[in] perm The vertex permutation
+  //! \param[in] weight Number of unknowns of each vertex (empty means one)
+  size_t bandwidth(const IntVec& xadj, const IntVec& adj, const IntVec& perm,
+                   const IntVec& weight = IntVec());
+
+  //! \brief Returns the number of nonzeros in the Cholesky factor.
+  //! \param[in] xadj Start index of each vertex in \a adj
+  //! \param[in] adj Neighbors of each vertex
+  //! \param[in] perm The vertex permutation
+  //! \param[in] weight Number of unknowns of each vertex (empty means one)
+  //!
+  //! \details The count includes the diagonal, and is computed from a
+  //! symbolic factorization using the elimination tree.
+  size_t factorSize(const IntVec& xadj, const IntVec& adj, const IntVec& perm,
+                    const IntVec& weight = IntVec());
+}
+
+#endif
@@ -136,6 +136,13 @@ public:
   //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
   virtual bool solve(SystemVector& B, bool newLHS, Real*);
 
+  //! \brief Solves the linear system of equations for a block of right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  //!
+  //! \details The columns of \a B are solved for one by one.
+  virtual bool solve(Matrix& B, bool newLHS = true, Real* = nullptr);
+
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param[in] B Right-hand-side vector
   //! \param[out] x Solution vector
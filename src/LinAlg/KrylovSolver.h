@@ -0,0 +1,177 @@
+// $Id$
+//==============================================================================
+//!
+//! \file KrylovSolver.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Built-in preconditioned Krylov subspace solvers for sparse matrices.
+//!
+//==============================================================================
+
+#ifndef _KRYLOV_SOLVER_H
+#define _KRYLOV_SOLVER_H
+
+#include "MatVec.h"
+
+class LinSolParams;
+class KrylovPreconditioner;
+
+typedef std::vector<int> IntVec; //!< General integer vector
+
+
+/*!
+  \brief Interface for coefficient operators of the Krylov subspace solvers.
+  \details This is used for coefficient matrices that are not available on
+  a sparse matrix format, but only through their action on a vector.
+*/
+
+class KrylovOperator
+{
+protected:
+  //! \brief The default constructor is protected to allow sub-classes only.
+  KrylovOperator() {}
+
+public:
+  //! \brief Empty destructor.
+  virtual ~KrylovOperator() {}
+
+  //! \brief Evaluates the matrix-vector product \b y = \b A \b x.
+  virtual bool multiply(const Vector& x, Vector& y) const = 0;
+};
+
+
+/*!
+  \brief Class with built-in iterative solvers for sparse linear systems.
+  \details The linear system is solved by either the conjugate gradient (CG),
+  the stabilized bi-conjugate gradient (BiCGStab) or the restarted generalized
+  minimal residual (GMRES) method. The available preconditioners are Jacobi,
+  incomplete LU factorization without fill-in (ILU(0)) and a smoothed
+  aggregation algebraic multigrid V-cycle (AMG).
+
+  The sparse matrix-vector products and the vector operations are parallelized
+  using OpenMP, as are the Jacobi smoothing sweeps of the AMG preconditioner.
+  The triangular solves of the ILU(0) preconditioner are sequential.
+
+  The solver parameters are taken from a LinSolParams object, using the same
+  keys as the PETSc and ISTL backends, i.e., \a type (cg, bicgstab/bcgs or
+  gmres), \a pc (none, jacobi, ilu/ilu0 or amg/gamg/ml), \a rtol, \a atol,
+  \a dtol, \a maxits and \a gmres_restart_iterations. The AMG preconditioner
+  further uses the \a multigrid_levels, \a multigrid_no_smooth,
+  \a multigrid_max_coarse_size and \a multigrid_block_size block settings.
+*/
+
+class KrylovSolver
+{
+public:
+  //! \brief Available Krylov subspace methods.
+  enum Method { CG, BICGSTAB, GMRES };
+  //! \brief Available preconditioners.
+  enum Preconditioner { NONE, JACOBI, ILU0, AMG };
+
+  /*!
+    \brief Compressed sparse row matrix with 0-based indices.
+  */
+  struct CSR
+  {
+    size_t nrow = 0; //!< Number of matrix rows
+    size_t ncol = 0; //!< Number of matrix columns
+    IntVec IA;       //!< Start index in \a JA and \a A of each row
+    IntVec JA;       //!< Column index of each non-zero element
+    RealArray A;     //!< The non-zero matrix elements
+
+    //! \brief Evaluates the matrix-vector product \b y = \b A \b x.
+    void multiply(const Vector& x, Vector& y) const;
+    //! \brief Evaluates the residual \b r = \b b - \b A \b x.
+    void residual(const Vector& b, const Vector& x, Vector& r) const;
+    //! \brief Extracts the matrix diagonal.
+    //! \return \e false if a diagonal element is zero or missing
+    bool diagonal(Vector& d) const;
+    //! \brief Computes the transpose of this matrix.
+    //! \details The columns of each row of \a T are sorted.
+    void transpose(CSR& T) const;
+  };
+
+  //! \brief The constructor initializes the solver parameters.
+  //! \param[in] spar Linear solver parameters (use defaults if null)
+  explicit KrylovSolver(const LinSolParams* spar = nullptr);
+  //! \brief Copy constructor.
+  //! \details Only the solver parameters are copied.
+  KrylovSolver(const KrylovSolver& ks);
+  //! \brief The destructor frees the preconditioner.
+  ~KrylovSolver();
+
+  //! \brief Defines the solver parameters.
+  void setParameters(const LinSolParams& spar);
+
+  //! \brief Sets up the coefficient matrix and the preconditioner.
+  //! \param[in] IA Start index in \a JA and \a A of each column
+  //! \param[in] JA 0-based row index of each non-zero element
+  //! \param[in] A The non-zero matrix elements
+  //!
+  //! \details The matrix is given on column-oriented format (as used by
+  //! the SuperLU solver) and is stored internally on row-oriented format.
+  bool setup(const IntVec& IA, const IntVec& JA, const RealArray& A);
+  //! \brief Sets up a matrix-free coefficient operator and its preconditioner.
+  //! \param[in] A The coefficient operator
+  //! \param[in] D The diagonal of the coefficient operator
+  //!
+  //! \details The operator is not copied, and must therefore be kept alive
+  //! until the last solve. Only the Jacobi preconditioner is available in
+  //! this case, since the other preconditioners need the explicit matrix.
+  bool setup(const KrylovOperator& A, const Vector& D);
+
+  //! \brief Solves the linear system for a given right-hand-side vector.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  bool solve(Vector& B);
+  //! \brief Solves the linear system for a given right-hand-side vector.
+  //! \param[in] B Right-hand-side vector
+  //! \param X Initial solution guess on input, solution vector on output
+  bool solve(const Vector& B, Vector& X);
+
+  //! \brief Returns the number of iterations used in the last solve.
+  int getNoIterations() const { return nIter; }
+  //! \brief Returns the relative residual norm of the last solve.
+  Real getResidual() const { return resid; }
+
+private:
+  //! \brief Evaluates the matrix-vector product \b y = \b A \b x.
+  bool multiply(const Vector& x, Vector& y) const;
+  //! \brief Evaluates the residual \b r = \b b - \b A \b x.
+  bool residual(const Vector& b, const Vector& x, Vector& r) const;
+  //! \brief Applies the preconditioner, \b z = \b M<sup>-1</sup> \b r.
+  void precond(const Vector& r, Vector& z) const;
+
+  //! \brief Preconditioned conjugate gradient method.
+  bool solveCG(const Vector& b, Vector& x);
+  //! \brief Preconditioned stabilized bi-conjugate gradient method.
+  bool solveBiCGStab(const Vector& b, Vector& x);
+  //! \brief Right-preconditioned restarted GMRES method.
+  bool solveGMRES(const Vector& b, Vector& x);
+
+  Method         method; //!< The Krylov subspace method to use
+  Preconditioner pcType; //!< The preconditioner to use
+
+  Real rTol;    //!< Relative residual tolerance
+  Real aTol;    //!< Absolute residual tolerance
+  Real dTol;    //!< Divergence tolerance
+  int  maxIt;   //!< Maximum number of iterations
+  int  restart; //!< Number of iterations before GMRES restart
+  int  verbose; //!< Verbosity level
+
+  int  mgLevels; //!< Maximum number of AMG levels
+  int  mgSmooth; //!< Number of AMG smoothing sweeps
+  int  mgCoarse; //!< Maximum size of the AMG coarsest level
+  int  mgBlock;  //!< Number of unknowns per node in the AMG aggregation
+
+  CSR                   myA;  //!< The coefficient matrix
+  const KrylovOperator* myOp; //!< The matrix-free coefficient operator, if any
+  KrylovPreconditioner* myPC; //!< The preconditioner
+
+  int  nIter; //!< Number of iterations used in the last solve
+  Real resid; //!< Relative residual norm of the last solve
+};
+
+#endif
@@ -27,7 +27,9 @@ namespace LinAlg //! Linear algebra scope
     PETSC   = 4, //!< Sparse matrices / PETSc solver
     ISTL    = 5, //!< Sparse matrices / Dune solver
     UMFPACK = 6, //!< Sparse matrices / UmfPack solver
-    DIAG    = 7  //!< Diagonal matrices / Trivial solver
+    DIAG    = 7, //!< Diagonal matrices / Trivial solver
+    ITERATIVE = 8, //!< Sparse matrices / Built-in Krylov solvers
+    MATRIXFREE = 9 //!< No matrices / Built-in Krylov solvers
   };
 
   //! \brief Enum defining linear system properties.
@@ -37,6 +39,15 @@ namespace LinAlg //! Linear algebra scope
     SYMMETRIC      = 1, //!< Symmetric matrix (value and structure)
     SPD            = 2  //!< Symmetric, positive definite matrix
   };
+
+  //! \brief The available equation orderings.
+  enum Ordering
+  {
+    NATURAL = 0, //!< Equations numbered in node order
+    RCM     = 1, //!< Reverse Cuthill-McKee (bandwidth-reducing)
+    AMD     = 2, //!< Approximate minimum degree (fill-reducing)
+    ND      = 3  //!< Nested dissection (fill-reducing)
+  };
 }
 
 #endif
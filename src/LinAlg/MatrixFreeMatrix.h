@@ -0,0 +1,149 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MatrixFreeMatrix.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Matrix-free system matrix representation.
+//!
+//==============================================================================
+
+#ifndef _MATRIX_FREE_MATRIX_H
+#define _MATRIX_FREE_MATRIX_H
+
+#include "SystemMatrix.h"
+
+class KrylovSolver;
+
+
+/*!
+  \brief Interface for coefficient matrices that are evaluated on the fly.
+  \details The operator acts on vectors in equation order, i.e., vectors
+  with one entry for each free DOF of the model.
+*/
+
+class MatrixFreeOperator
+{
+protected:
+  //! \brief The default constructor is protected to allow sub-classes only.
+  MatrixFreeOperator() {}
+
+public:
+  //! \brief Empty destructor.
+  virtual ~MatrixFreeOperator() {}
+
+  //! \brief Adds the matrix-vector product \b A \b x into a given vector.
+  //! \param[in] x The vector to multiply with
+  //! \param y The vector to add the product into
+  virtual bool apply(const Vector& x, Vector& y) = 0;
+};
+
+
+/*!
+  \brief Class for representing a system matrix by a matrix-free operator.
+  \details The matrix is represented by &alpha;\b A + &sigma;\b I, where \b A
+  is a MatrixFreeOperator object. The element matrices are not assembled,
+  only their diagonal, which is used by the Jacobi preconditioner. The
+  contributions from inhomogeneous Dirichlet conditions and multi-point
+  constraints are added into the right-hand-side vector, in the same way
+  as for the other matrix formats.
+
+  The linear system is solved by the built-in Krylov subspace solvers,
+  see KrylovSolver, using the same solver parameters as for them.
+*/
+
+class MatrixFreeMatrix : public SystemMatrix
+{
+public:
+  //! \brief Default constructor.
+  //! \param[in] spar Linear solver parameters (use defaults if null)
+  explicit MatrixFreeMatrix(const LinSolParams* spar = nullptr);
+  //! \brief Copy constructor.
+  MatrixFreeMatrix(const MatrixFreeMatrix& A);
+  //! \brief The destructor frees the equation solver.
+  virtual ~MatrixFreeMatrix();
+
+  //! \brief Returns the matrix type.
+  virtual LinAlg::MatrixType getType() const { return LinAlg::MATRIXFREE; }
+
+  //! \brief Creates a copy of the system matrix and returns a pointer to it.
+  virtual SystemMatrix* copy() const { return new MatrixFreeMatrix(*this); }
+
+  //! \brief Defines the operator representing this matrix.
+  void setOperator(MatrixFreeOperator* op) { myOp = op; }
+
+  //! \brief Returns the dimension of the system matrix.
+  virtual size_t dim(int = 1) const { return myDiag.size(); }
+
+  //! \brief Initializes the element assembly process.
+  //! \details Must be called once before the element assembly loop.
+  //! \param[in] sam Auxiliary data describing the FE model topology, etc.
+  virtual void initAssembly(const SAM& sam, bool);
+
+  //! \brief Initializes the matrix to zero assuming it is properly dimensioned.
+  virtual void init();
+
+  //! \brief Adds the diagonal of an element matrix into the system diagonal.
+  //! \param[in] eM  The element matrix
+  //! \param[in] sam Auxiliary data describing the FE model topology,
+  //!                nodal DOF status and constraint equations
+  //! \param[in] e   Identifier for the element that \a eM belongs to
+  //! \return \e true on successful assembly, otherwise \e false
+  //!
+  //! \details The constrained DOFs are not accounted for, so the system
+  //! diagonal is only an approximation in the presence of multi-point
+  //! constraints. It is only used for preconditioning.
+  virtual bool assemble(const Matrix& eM, const SAM& sam, int e);
+  //! \brief Adds the diagonal of an element matrix into the system diagonal.
+  //! \details The contributions from inhomogeneous Dirichlet conditions and
+  //! multi-point constraints are added into the right-hand-side vector.
+  //! \param[in] eM  The element matrix
+  //! \param[in] sam Auxiliary data describing the FE model topology,
+  //!                nodal DOF status and constraint equations
+  //! \param     B   The system right-hand-side vector
+  //! \param[in] e   Identifier for the element that \a eM belongs to
+  //! \return \e true on successful assembly, otherwise \e false
+  virtual bool assemble(const Matrix& eM, const SAM& sam,
+                        SystemVector& B, int e);
+
+  //! \brief Multiplication with a scalar.
+  virtual void mult(Real c) { alpha *= c; sigma *= c; }
+
+  //! \brief Adds the diagonal matrix &sigma;\b I to the current matrix.
+  virtual bool add(Real s) { sigma += s; return true; }
+
+  //! \brief Performs the matrix-vector multiplication \b C = \a *this * \b B.
+  virtual bool multiply(const SystemVector& B, SystemVector& C) const;
+
+  //! \brief Evaluates the matrix-vector product \b y = \a *this * \b x.
+  bool apply(const Vector& x, Vector& y) const;
+
+  using SystemMatrix::solve;
+  //! \brief Solves the linear system of equations for a given right-hand-side.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  virtual bool solve(SystemVector& B, bool, Real*);
+  //! \brief Solves the linear system of equations for a given right-hand-side.
+  //! \param[in] B Right-hand-side vector
+  //! \param X Initial guess on input, solution vector on output
+  virtual bool solve(const SystemVector& B, SystemVector& X, bool);
+
+  //! \brief Returns the L-infinity norm of the matrix diagonal.
+  //! \details The row sums of the matrix are not available.
+  virtual Real Linfnorm() const;
+
+private:
+  //! \brief Computes the matrix diagonal for the Jacobi preconditioner.
+  bool getDiagonal(Vector& D) const;
+
+  MatrixFreeOperator* myOp;   //!< The operator representing the matrix
+  Vector              myDiag; //!< Diagonal of the operator
+  KrylovSolver*       krylov; //!< The equation solver
+
+  Real alpha; //!< Scaling factor of the operator
+  Real sigma; //!< Diagonal shift
+};
+
+#endif
@@ -133,6 +133,17 @@ public:
   //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
   virtual bool solve(SystemVector& B, bool newLHS, Real*);
 
+  //! \brief Solves the linear system of equations for a block of right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  //!
+  //! \details The first column of \a B is solved for separately, to set up
+  //! the preconditioner (or factorization). With PETSc 3.14 or later, the
+  //! remaining columns are then solved for in one call to KSPMatSolve,
+  //! otherwise they are solved for one by one. This method is available in
+  //! serial runs only, since \a B is not distributed over the processes.
+  virtual bool solve(Matrix& B, bool newLHS = true, Real* = nullptr);
+
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param[in] B Right-hand-side vector
   //! \param[out] x Solution vector
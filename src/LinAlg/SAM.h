@@ -15,6 +15,7 @@
 #define _SAM_H
 
 #include "MatVec.h"
+#include "LinAlgenums.h"
 #include <set>
 #include <map>
 
@@ -46,6 +47,10 @@ public:
   //! \brief Prints out the key data to the given stream.
   void print(std::ostream& os) const;
 
+  //! \brief Defines the node ordering to use when numbering the equations.
+  //! \details Must be invoked before the equation numbers are initialized.
+  void setEquationOrdering(LinAlg::Ordering method) { eqOrder = method; }
+
   //! \brief Returns the number of elements in the model.
   int getNoElms() const { return nel; }
   //! \brief Returns the number of FE nodes in the model.
@@ -168,6 +173,20 @@ public:
   //! \param[in] S  The global load vector
   void addToRHS(SystemVector& sysRHS, const RealArray& S) const;
 
+  //! \brief Adds the product of an element matrix and a system vector
+  //! into another system vector, without assembling the matrix.
+  //! \param sysY   The system vector to add the product into
+  //! \param[in] eK  The element matrix
+  //! \param[in] sysX The system vector to multiply with
+  //! \param[in] iel Identifier for the element that \a eK belongs to
+  //! \return \e true on successful assembly, otherwise \e false
+  //!
+  //! \details The values of the constrained DOFs of the element are obtained
+  //! from their master DOFs. The inhomogeneous part of the constraints is
+  //! ignored, since it is accounted for in the right-hand-side vector.
+  bool assembleProduct(Vector& sysY, const Matrix& eK,
+                       const Vector& sysX, int iel) const;
+
   //! \brief Finds the matrix of nodal point correspondance for an element.
   //! \param[out] mnpc Matrix of nodal point correspondance
   //! \param[in] iel Identifier for the element to get the node numbers for
@@ -181,6 +200,15 @@ public:
   //! \brief Returns the number equations for an element.
   //! \param[in] iel Identifier for the element to get number of equations for
   size_t getNoElmEqns(int iel) const;
+  //! \brief Finds all system entries an element may contribute to.
+  //! \param targets Set of affected system entries, found entries are added
+  //! \param[in] iel Identifier for the element to get the entries for
+  //!
+  //! \details The positive entries in \a targets are the equation numbers,
+  //! including the master DOFs of the constrained DOFs of the element, whereas
+  //! the negative entries are (negated) indices into the reaction force vector.
+  //! Elements with disjoint sets of targets can be assembled concurrently.
+  bool getElmTargets(IntSet& targets, int iel) const;
 
   //! \brief Finds the matrix of equation numbers for a node.
   //! \param[out] mnen Matrix of node equation numbers
@@ -230,6 +258,16 @@ public:
   //! \details This version is typically used to expand eigenvectors.
   bool expandVector(const Vector& solVec, Vector& dofVec) const;
 
+  //! \brief Restricts a DOF-ordered vector to equation-ordering.
+  //! \param[in] dofVec Degrees of freedom vector, length = NDOF
+  //! \param solVec Solution vector, length = NEQ
+  //! \return \e false if the length of \a dofVec is invalid, otherwise \e true
+  //!
+  //! \details This is the inverse of expandSolution() for the free DOFs.
+  //! It is typically used to set up an initial guess for iterative solvers.
+  //! The \a solVec vector is assumed to be zero-initialized on input.
+  bool restrictSolution(const Vector& dofVec, SystemVector& solVec) const;
+
   //! \brief Applies the non-homogenous Dirichlet BCs to the given vector.
   //! \param dofVec Degrees of freedom vector, length = NDOF
   //!
@@ -282,7 +320,18 @@ public:
 
 protected:
   //! \brief Initializes the DOF-to-equation connectivity array \a MEQN.
+  //! \details The element equation numbers are also cached (see initElmEqns).
   bool initSystemEquations();
+  //! \brief Caches the element equation numbers \a MEEN of all elements.
+  //! \details This is invoked by initSystemEquations, such that the equation
+  //! numbers need not be recomputed each time an element is assembled.
+  bool initElmEqns();
+  //! \brief Renumbers the equations according to the node ordering \a eqOrder.
+  //! \details This is invoked by initSystemEquations. The nodes are reordered
+  //! by their connectivity graph, including the couplings through multi-point
+  //! constraints, and the equations of each node are kept consecutive within
+  //! each of the two equation blocks (status code 1 and 2).
+  bool renumberEquations();
 
   //! \brief Adds a scalar value into a system right hand-side vector.
   //! \param RHS The right-hand-side system load vector
@@ -338,9 +387,14 @@ protected:
   int*  minex;  //!< Matrix of internal to external node numbers
   int*  meqn;   //!< Matrix of equation numbers
 
+  IntVec mpmeen; //!< Matrix of pointers to MEENs in MMEEN (0-based)
+  IntVec mmeen;  //!< Matrix of matrices of element equation numbers
+
   std::vector<char> nodeType; //!< Nodal DOF classification
   std::vector<char> dof_type; //!< Individual DOF classification
 
+  LinAlg::Ordering eqOrder; //!< Node ordering used for the equation numbers
+
   friend class DenseMatrix;
   friend class SPRMatrix;
   friend class SparseMatrix;
@@ -91,6 +91,9 @@ public:
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param B Right-hand-side vector on input, solution vector on output
   virtual bool solve(SystemVector& B, bool, Real*);
+  //! \brief Solves the linear system of equations for a block of right-hand-sides.
+  //! \param B Right-hand-side matrix on input, solution matrix on output
+  virtual bool solve(Matrix& B, bool, Real*);
 
   //! \brief Solves a generalized symmetric-definite eigenproblem.
   //! \param B Symmetric and positive definite mass matrix.
@@ -106,6 +109,11 @@ public:
   virtual Real Linfnorm() const;
 
 private:
+  //! \brief Solves the linear system of equations for \a nrhs right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[in] nrhs Number of right-hand-side vectors
+  bool solve(Real* B, size_t nrhs);
+
   int mpar[NS] = {};      //!< Matrix of sparse PARameters
   int* msica = nullptr;   //!< Matrix of Storage Information for CA
   int* msifa = nullptr;   //!< Matrix of Storage Information for FA
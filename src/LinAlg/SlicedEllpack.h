@@ -0,0 +1,77 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SlicedEllpack.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Sliced ELLPACK storage for sparse matrix-vector multiplication.
+//!
+//==============================================================================
+
+#ifndef _SLICED_ELLPACK_H
+#define _SLICED_ELLPACK_H
+
+#include "MatVec.h"
+
+typedef std::vector<int> IntVec; //!< General integer vector
+
+
+/*!
+  \brief Sliced ELLPACK (SELL-C-&sigma;) index of a sparse matrix.
+  \details The matrix rows are sorted on decreasing length within windows
+  of &sigma; consecutive rows, and then grouped into chunks of \a C rows.
+  Each chunk is stored column-wise and padded to the length of its longest
+  row, such that the \a C rows of a chunk are processed simultaneously in
+  vectorizable inner loops. The chunks are distributed over the threads,
+  so each thread writes to its own rows of the result vector only.
+
+  The index is built from a column-oriented matrix (as used by the SuperLU
+  solver), and keeps the storage index of each entry in that matrix such
+  that the matrix values can be refreshed without rebuilding the index.
+*/
+
+class SlicedEllpack
+{
+public:
+  //! \brief The constructor defines the chunk size and sorting window.
+  //! \param[in] chunk Number of rows in each chunk (C), at most 16
+  //! \param[in] window Number of rows in each sorting window (&sigma;)
+  explicit SlicedEllpack(int chunk = 8, int window = 256);
+
+  //! \brief Erases the index and the matrix values.
+  void clear();
+  //! \brief Returns \e true if the index has not been built.
+  bool empty() const { return rowPerm.empty(); }
+
+  //! \brief Builds the index from a column-oriented sparse matrix pattern.
+  //! \param[in] nrow Number of matrix rows
+  //! \param[in] IA Start index in \a JA of each column
+  //! \param[in] JA 0-based row index of each non-zero element
+  void build(size_t nrow, const IntVec& IA, const IntVec& JA);
+
+  //! \brief Copies the matrix values into the sliced storage.
+  //! \param[in] A The non-zero matrix elements in column-oriented order
+  void setValues(const RealArray& A);
+
+  //! \brief Evaluates the matrix-vector product \b y = \b A \b x.
+  //! \details The output vector \a y must be of length \a nrow.
+  void multiply(const Real* x, Real* y) const;
+
+private:
+  static const int maxChunk = 16; //!< Largest allowed chunk size
+
+  int C;     //!< Number of rows in each chunk
+  int sigma; //!< Number of rows in each sorting window
+
+  size_t nrow;     //!< Number of matrix rows
+  IntVec chunkPtr; //!< Start index of each chunk in \a col and \a val
+  IntVec rowPerm;  //!< Original row index of each sorted row (-1 if padding)
+  IntVec col;      //!< Column index of each sliced entry
+  IntVec src;      //!< Column-oriented storage index of each sliced entry
+  RealArray val;   //!< The sliced matrix values
+};
+
+#endif
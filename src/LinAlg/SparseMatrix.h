@@ -15,6 +15,7 @@
 #define _SPARSE_MATRIX_H
 
 #include "SystemMatrix.h"
+#include "SlicedEllpack.h"
 #include <iostream>
 #include <map>
 #include <set>
@@ -25,6 +26,8 @@ typedef std::map<IJPair,Real>    ValueMap;  //!< Index to matrix value mapping
 typedef ValueMap::const_iterator ValueIter; //!< Iterator over matrix elements
 
 struct SuperLUdata;
+class KrylovSolver;
+class LinSolParams;
 
 
 /*!
@@ -32,17 +35,21 @@ struct SuperLUdata;
   \details The sparse matrix is editable in the sense that non-zero entries may
   be added at arbitrary locations. The class comes with methods for solving a
   linear system of equations based on the current matrix and a given RHS-vector,
-  using either the commercial SAMG package or the public domain SuperLU package.
+  using either the commercial SAMG package, the public domain SuperLU or UMFPACK
+  packages, or the built-in preconditioned Krylov subspace solvers.
 */
 
 class SparseMatrix : public SystemMatrix
 {
 public:
   //! \brief Available equation solvers for this matrix type.
-  enum SparseSolver { NONE, SUPERLU, S_A_M_G, UMFPACK };
+  enum SparseSolver { NONE, SUPERLU, S_A_M_G, UMFPACK, ITERATIVE };
 
   //! \brief Default constructor creating an empty matrix.
   SparseMatrix(SparseSolver eqSolver = NONE, int nt = 1);
+  //! \brief Constructor creating an empty matrix with an iterative solver.
+  //! \param[in] spar Linear solver parameters for the Krylov solver
+  explicit SparseMatrix(const LinSolParams& spar);
   //! \brief Constructor creating a \f$m \times n\f$ matrix.
   SparseMatrix(size_t m, size_t n = 0);
   //! \brief Copy constructor.
@@ -85,6 +92,9 @@ public:
   virtual size_t dim(int idim = 1) const;
 
   //! \brief Index-1 based element access.
+  //! \details Updates of the matrix values through this operator must be
+  //! bracketed by beginAssembly() and endAssembly(), such that the sliced
+  //! copy of the values used by multiply() is refreshed.
   Real& operator()(size_t r, size_t c);
   //! \brief Index-1 based element reference.
   const Real& operator()(size_t r, size_t c) const;
@@ -121,6 +131,13 @@ public:
   //! \brief Initializes the matrix to zero assuming it is properly dimensioned.
   virtual void init();
 
+  //! \brief Begins the matrix assembly.
+  //! \details Invalidates the sliced copy of the matrix values, if any.
+  virtual bool beginAssembly() { sellValues = false; return true; }
+  //! \brief Ends the matrix assembly.
+  //! \details Invalidates the sliced copy of the matrix values, if any.
+  virtual bool endAssembly() { sellValues = false; return true; }
+
   //! \brief Adds an element matrix into the associated system matrix.
   //! \param[in] eM  The element matrix
   //! \param[in] sam Auxiliary data describing the FE model topology,
@@ -151,6 +168,20 @@ public:
   virtual bool assemble(const Matrix& eM, const SAM& sam,
 			SystemVector& B, const IntVec& meen);
 
+  //! \brief Adds the free-DOF terms of an element matrix into this matrix.
+  //! \param[in] eM   The element matrix
+  //! \param[in] meen Matrix of element equation numbers
+  //! \param[in] iel  Identifier for the element that \a eM belongs to
+  //!
+  //! \details Only the terms associated with positive equation numbers in
+  //! \a meen are added. When the sparsity pattern is permanently locked in the
+  //! column-oriented format, the terms are added directly into the non-zero
+  //! storage, without any index-pair map lookups. If a scatter table has been
+  //! computed (see initScatter), the storage indices of element \a iel are
+  //! taken from that table. Concurrent invocations are safe as long as the
+  //! elements do not share any equations.
+  void addFreeTerms(const Matrix& eM, const IntVec& meen, int iel = 0);
+
   //! \brief Adds a nodal vector into columns of a non-symmetric sparse matrix.
   //! \param[in] V   The nodal vector
   //! \param[in] sam Auxiliary data describing the FE model topology,
@@ -208,6 +239,22 @@ public:
   //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
   //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
   virtual bool solve(SystemVector& B, bool newLHS = true, Real* rc = nullptr);
+  //! \brief Solves the linear system of equations for a given right-hand-side.
+  //! \param[in] b Right-hand-side vector
+  //! \param x Initial guess on input (iterative solver only), solution vector
+  //! on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  virtual bool solve(const SystemVector& b, SystemVector& x, bool newLHS);
+  //! \brief Solves the linear system of equations for a block of right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
+  //!
+  //! \details With the SuperLU solver, all columns of \a B are processed in
+  //! one blocked triangular solve, using the same factorization.
+  //! UMFPACK has no interface for multiple right-hand-sides, the columns are
+  //! therefore solved for one by one, re-using the numerical factorization.
+  virtual bool solve(Matrix& B, bool newLHS = true, Real* rc = nullptr);
 
   //! \brief Calculate compressed-sparse-row arrays from element map.
   //! \param[out] IA Start index of each row in JA
@@ -218,6 +265,13 @@ public:
                       size_t nrow, const ValueMap& elem);
 
 protected:
+  //! \brief Computes the non-zero storage indices of all element matrices.
+  //! \param[in] sam Auxiliary data describing the FE model topology, etc.
+  //!
+  //! \details The table is computed only if its size does not exceed
+  //! \a maxScatterSize times the number of non-zero matrix elements.
+  void initScatter(const SAM& sam);
+
   //! \brief Converts the matrix to an optimized row-oriented format.
   //! \details The optimized format is suitable for the SAMG equation solver.
   bool optimiseSAMG(bool transposed = false);
@@ -247,19 +301,53 @@ protected:
   //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
   bool solveSLUx(Vector& B, Real* rcond);
 
+  //! \brief Invokes the SuperLU equation solver in mixed precision.
+  //! \details The matrix is factorized in single precision, and the solution
+  //! is refined iteratively to double precision accuracy.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
+  bool solveSLUmixed(Vector& B, Real* rcond);
+
   //! \brief Invokes the UMFPACK equation solver for a given right-hand-side.
   //! \param B Right-hand-side vector on input, solution vector on output
   //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
   bool solveUMF(Vector& B, Real* rcond);
 
+  //! \brief Invokes the built-in Krylov solver for a given right-hand-side.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  bool solveKrylov(Vector& B, bool newLHS);
+  //! \brief Invokes the built-in Krylov solver with an initial guess.
+  //! \param[in] B Right-hand-side vector
+  //! \param X Initial guess on input, solution vector on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  bool solveKrylov(const Vector& B, Vector& X, bool newLHS);
+  //! \brief Sets up the built-in Krylov solver and its preconditioner.
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  bool setupKrylov(bool newLHS);
+
   //! \brief Writes the system matrix to the given output stream.
   virtual std::ostream& write(std::ostream& os) const;
 
   //! \brief Returns the L-infinity norm of the matrix.
   virtual Real Linfnorm() const;
 
+private:
+  //! \brief Evaluates \b y = \b A \b x for the column-oriented format.
+  void multiplyCSC(const Real* x, Real* y) const;
+
+  //! \brief Returns \e true if the optimized storage is column-oriented.
+  bool isColumnOriented() const
+  {
+    return solver == SUPERLU || solver == UMFPACK || solver == ITERATIVE;
+  }
+
 public:
   static bool printSLUstat; //!< Print solution statistics for SuperLU?
+  //! Factorize in single precision with iterative refinement (SuperLU only)?
+  static bool mixedPrecision;
+  //! Max size of the element scatter table relative to the number of nonzeros
+  static double maxScatterSize;
 
 private:
   //! Flag for the editability of the matrix elements:
@@ -273,12 +361,19 @@ private:
   size_t ncol;   //!< Number of matrix columns
 
   ValueMap       elem; //!< Stores nonzero matrix elements with index pairs
+  IntVec   elmSlotPtr; //!< Start index of each element in \a elmSlots
+  IntVec     elmSlots; //!< Storage index in \a A of each element matrix term
   SparseSolver solver; //!< Which equation solver to use
   SuperLUdata*    slu; //!< Matrix data for the SuperLU equation solver
   int      numThreads; //!< Number of threads to use for the SuperLU_MT solver
+  KrylovSolver* krylov; //!< The built-in iterative equation solver
+
+  mutable SlicedEllpack sell; //!< Sliced storage for matrix-vector products
+  mutable bool sellValues; //!< \e true if \a sell has the current values
 
 #ifdef HAS_UMFPACK
   void* umfSymbolic; //!< Symbolically factored matrix for UMFPACK
+  void* umfNumeric;  //!< Numerically factored matrix for UMFPACK
 #endif
 
 protected:
@@ -307,6 +307,19 @@ public:
     return this->solve(x.copy(b),newLHS);
   }
 
+  //! \brief Solves the linear system of equations for a block of right-hand-sides.
+  //! \param B Right-hand-side vectors on input, solution vectors on output,
+  //! stored column-wise with one right-hand-side vector in each column
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
+  //!
+  //! \details The default implementation solves for one column at a time,
+  //! re-using the factorization of the first column for the remaining ones.
+  //! Sub-classes with direct solvers override this method, such that
+  //! all columns are solved for in one forward/backward substitution
+  //! where the underlying solver library supports it.
+  virtual bool solve(Matrix& B, bool newLHS = true, Real* rc = nullptr);
+
   //! \brief Returns the L-infinity norm of the matrix.
   virtual Real Linfnorm() const = 0;
 
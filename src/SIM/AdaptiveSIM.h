@@ -89,6 +89,10 @@ protected:
   virtual bool assembleAndSolveSystem();
 
 private:
+  //! \brief Passes the solutions transferred to the refined mesh to the model.
+  //! \details They are used as initial guesses by iterative equation solvers.
+  void setInitialGuess();
+
   Vectors gNorm; //!< Global norms
   Vectors dNorm; //!< Dual global norms
   Matrix  eNorm; //!< Element norms
@@ -101,6 +105,8 @@ private:
   std::vector<Vector>      projd;  //!< Projected dual solutions
   std::vector<std::string> prefix; //!< Norm prefices for VTF-output
 
+  Vectors prevSol; //!< Previous solutions transferred to the refined mesh
+
 protected:
   Vectors solution; //!< All solutions (including Galerkin projections)
 };
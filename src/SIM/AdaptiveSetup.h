@@ -92,6 +92,8 @@ protected:
   size_t adNorm;  //!< Which norm to base the mesh adaptation on
   size_t eRow;    //!< Row-index in \a eNorm of the norm to use for adaptation
   double rCond;   //!< Actual reciprocal condition number of the last mesh
+  bool   inMemory; //!< If \e true, regenerate the refined model in-memory
+  bool   reuseElm; //!< If \e true, reuse element matrices of unmodified elements
 
 private:
   bool   alone;      //!< If \e false, this class is wrapped by SIMSolver
@@ -21,6 +21,7 @@
 class SIMoutput;
 class SIMbase;
 class TimeStep;
+class TiXmlElement;
 struct TimeDomain;
 
 
@@ -39,8 +40,8 @@ protected:
   explicit MultiStepSIM(SIMbase& sim);
 
 public:
-  //! \brief Empty destructor.
-  virtual ~MultiStepSIM() {}
+  //! \brief The destructor prints out the linear solver statistics, if any.
+  virtual ~MultiStepSIM();
 
   //! \brief Prints out problem-specific data to the log stream.
   virtual void printProblem() const;
@@ -83,6 +84,17 @@ protected:
   //! \brief Returns the last step that was save to VTF
   int getLastSavedStep() const { return lastSt; }
 
+  //! \brief Checks whether the tangent matrix needs to be updated.
+  //! \param[in] param Time stepping parameters
+  //! \return \e false if the current factorization can be re-used
+  bool updateTangent(const TimeStep& param) const;
+  //! \brief Solves the assembled linear system of equations.
+  //! \param[in] newLHS If \e false, re-use the factorized LHS-matrix
+  bool solveLinear(bool newLHS = true);
+  //! \brief Parses the tangent matrix re-use policy from an XML element.
+  //! \param[in] elem The XML element to parse
+  void parseReuse(const TiXmlElement* elem);
+
 public:
   //! \brief Performs some pre-processing tasks on the FE model.
   //! \param[in] ignored Indices of patches to ignore in the analysis
@@ -128,6 +140,12 @@ public:
   //! \brief Set solution vectors from a serialized state.
   //! \param[in] data Container for serialized data
   virtual bool deSerialize(const SerializeMap& data);
+  //! \brief Adds references to the solution vectors for restarting purposes.
+  //! \param data Container for typed restart data
+  virtual bool serializeArrays(ArrayMap& data) const;
+  //! \brief Adds references to the solution vectors to restore on restart.
+  //! \param data Container for typed restart data
+  virtual bool deSerializeArrays(ArrayMap& data);
   //! \brief Restores solution state from serialized data in case of restart.
   bool checkForRestart();
 
@@ -158,6 +176,11 @@ public:
   //! \brief Returns whether this solution driver is linear or not.
   virtual bool isLinear() const { return true; }
 
+  //! \brief Returns the number of tangent matrix factorizations.
+  int getNoFactorizations() const { return nFactor; }
+  //! \brief Returns the number of linear equation solves.
+  int getNoSolves() const { return nSolve; }
+
   //! \brief Returns a const reference to the FE model.
   const SIMoutput& getModel() const { return model; }
 
@@ -199,6 +222,13 @@ protected:
   int geoBlk; //!< Running VTF geometry block counter
   int nBlock; //!< Running VTF result block counter
 
+  double reuseRate; //!< Convergence rate limit for re-use of the tangent
+  bool   reuseStep; //!< If \e true, re-use the tangent also across steps
+  bool   factored;  //!< If \e true, a factorized tangent matrix exists
+  double convRate;  //!< Ratio between the two last iteration norms
+  int    nFactor;   //!< Number of tangent matrix factorizations
+  int    nSolve;    //!< Number of linear equation solves
+
 private:
   int lastSt; //!< The last step that was saved to VTF
 };
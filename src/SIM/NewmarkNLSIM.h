@@ -205,6 +205,12 @@ public:
   //! \brief Set solution vectors from a serialized state.
   //! \param[in] data Container for serialized data
   virtual bool deSerialize(const SerializeMap& data);
+  //! \brief Adds references to the solution vectors for restarting purposes.
+  //! \param data Container for typed restart data
+  virtual bool serializeArrays(ArrayMap& data) const;
+  //! \brief Adds references to the solution vectors to restore on restart.
+  //! \param data Container for typed restart data
+  virtual bool deSerializeArrays(ArrayMap& data);
 
 protected:
   //! \brief Calculates predicted velocities and accelerations.
@@ -19,6 +19,7 @@
 #include "TimeDomain.h"
 #include "Property.h"
 #include "MatVec.h"
+#include "SpatialIndex.h"
 #include <set>
 
 class IntegrandBase;
@@ -26,6 +27,7 @@ class NormBase;
 class ForceBase;
 class AnaSol;
 class SAM;
+class GlobalIntegral;
 class AlgEqSystem;
 class LinSolParams;
 class SystemMatrix;
@@ -93,6 +95,11 @@ public:
   //! \details Use this method to clear the model before re-reading
   //! the input file in the refinement step of an adaptive simulation.
   virtual void clearProperties();
+  //! \brief Clears the FE data structures of the model.
+  //! \details Unlike clearProperties(), this method retains all properties
+  //! and functions of the model. Use it to regenerate the FE model in-memory
+  //! in the refinement step of an adaptive simulation.
+  virtual void clearFEMdata();
 
   //! \brief Performs some pre-processing tasks on the FE model.
   //! \param[in] ignored Indices of patches to ignore in the analysis
@@ -219,6 +226,15 @@ public:
 
   //! \brief Finds the node that is closest to the given point \b X.
   int findClosestNode(const Vec3&) const;
+  //! \brief Finds the patch and parameters of a given spatial point.
+  //! \param X Cartesian coordinates of the point, projected point on output
+  //! \param[out] param Parameters of the point in the knot-span domain
+  //! \param[in] tol Tolerance, relative to the size of the model
+  //! \return Global patch number containing the point, 0 if not found
+  //!
+  //! \details The candidate elements are found from a spatial index of the
+  //! element bounding boxes, and the point is then inverted by the patch.
+  int findPoint(Vec3& X, double* param, double tol = 1.0e-6) const;
 
   //! \brief Initializes time-dependent in-homogeneous Dirichlet coefficients.
   //! \param[in] time Current time
@@ -307,9 +323,21 @@ public:
   //! \param[out] solution Global primary solution vectors
   //! \param[in] printSol Print solution if its size is less than \a printSol
   //! \param[in] cmpName Solution name to be used in norm output
+  //!
+  //! \details When the right-hand-side vectors are of standard type, and no
+  //! solution dumps nor initial guesses are requested, all vectors are solved
+  //! for in one call to SystemMatrix::solve(Matrix&,bool,Real*), such that
+  //! the factorization is shared among the right-hand-sides.
   bool solveSystem(Vectors& solution, int printSol = 0,
                    const char* cmpName = "displacement");
 
+  //! \brief Defines initial guesses for the next equation solutions.
+  //! \param[in] guess Global solution vectors in DOF-order, one for each RHS
+  //!
+  //! \details The guesses are only used by the iterative equation solvers,
+  //! and each of them is discarded after it has been used once.
+  void setInitialGuess(const Vectors& guess) { initGuess = guess; }
+
   //! \brief Finds the DOFs showing the worst convergence behavior.
   //! \param[in] x Global primary solution vector
   //! \param[in] r Global residual vector associated with the solution vector
@@ -715,6 +743,33 @@ protected:
   bool addMADOF(unsigned char basis, unsigned char nndof, bool other = true);
 
 private:
+  class MatrixFreeOp;
+
+  //! \brief Generates groups of patches that can be assembled concurrently.
+  //! \details The patches within each group do not share any system entries,
+  //! including the master DOFs of multi-point constraints.
+  void generatePatchGroups();
+  //! \brief Creates integrand copies for concurrent patch assembly.
+  //! \param[in] itg The integrand to create copies of
+  //! \param[in] sysQ The global integral to assemble into
+  //! \param[out] itgs The integrand \a itg followed by one copy per thread
+  //! \return \e false if the patches have to be assembled one by one
+  //!
+  //! \details The material and Neumann properties are initialized before the
+  //! copies are created, and must therefore be the same for all patches.
+  bool getThreadCopies(IntegrandBase* itg, const GlobalIntegral& sysQ,
+                       std::vector<IntegrandBase*>& itgs);
+  //! \brief Assembles the interior terms of all patches concurrently.
+  //! \details The Neumann boundary terms of each patch are assembled by the
+  //! same thread, right after the interior terms of that patch.
+  //! \param itgs Integrand objects, one for each thread (copies are deleted)
+  //! \param sysQ The global integral to assemble into
+  //! \param[in] time Parameters for nonlinear and time-dependent simulations
+  //! \param[in] prevSol Previous primary solution vectors in DOF-order
+  bool assemblePatchwise(std::vector<IntegrandBase*>& itgs,
+                         GlobalIntegral& sysQ, const TimeDomain& time,
+                         const Vectors& prevSol);
+
   //! \brief Returns an extraordinary MADOF array.
   //! \param[in] basis The basis to specify number of DOFs for
   //! \param[in] nndof Number of nodal DOFs on the given basis
@@ -787,6 +842,7 @@ protected:
   SAM*          mySam;       //!< Auxiliary data for FE assembly management
   LinSolParams* mySolParams; //!< Input parameters for PETSc
   LinSolParams* myGl2Params; //!< Input parameters for PETSc, for L2 projection
+  Vectors       initGuess;   //!< Initial guesses for iterative solvers
 
 private:
   size_t nIntGP; //!< Number of interior integration points in the whole model
@@ -794,11 +850,20 @@ private:
   size_t nDofS;  //!< Number of degrees of freedom in this sub-simulator
   char   mdFlag; //!< Sequence flag for multi-dimensional simulators
 
+  std::vector< std::vector<int> > patchGroups; //!< Concurrent patch groups
+
+  MatrixFreeOp* myOperator; //!< Matrix-free operator for the system matrix
+
   //! Additional MADOF arrays for mixed problems (extraordinary DOF counts)
   std::map<int, std::vector<int> > mixedMADOFs;
 
   mutable double extEnergy;  //!< Path integral of external forces
   mutable Vector prevForces; //!< Reaction forces of previous time step
+
+  mutable SpatialIndex nodeIndex; //!< Spatial index of the nodal points
+  mutable SpatialIndex elmIndex;  //!< Spatial index of the element boxes
+  //! Patch index and local element number of each item in \a elmIndex
+  mutable std::vector<std::pair<size_t,int>> elmIndexRef;
 };
 
 #endif
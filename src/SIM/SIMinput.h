@@ -175,6 +175,20 @@ public:
   //! \param[in] sol Vectors to interpolate onto refined mesh
   bool refine(const LR::RefineData& prm, Vectors& sol);
 
+  //! \brief Regenerates the FE model in-memory after a mesh refinement.
+  //! \details All properties, functions and topology sets are retained,
+  //! only the FE data structures of the patches are regenerated and the patch
+  //! connections re-established. The model then needs to be preprocessed
+  //! again, to update the node and equation numbering.
+  bool regenerateFEMmodel();
+  //! \brief Enables caching of interior element matrices between refinements.
+  //! \param[in] enable If \e false, the caches are disabled and released
+  //! \details Only the elements that are new or modified by a subsequent
+  //! mesh refinement are then integrated again, whereas the cached element
+  //! matrices are used for the other elements. This is only valid for linear
+  //! problems where the main integrand is unchanged between the assemblies.
+  void reuseElementMatrices(bool enable);
+
   //! \brief Reads patches from given input stream.
   //! \param[in] isp The input stream to read from
   //! \param[in] whiteSpace For message formatting
@@ -249,6 +263,11 @@ public:
 
   //! \brief Deserialization support (for simulation restart).
   virtual bool deSerialize(const std::map<std::string,std::string>&);
+  //! \brief Typed restart support, registers the arrays to read into.
+  //! \details Not supported by default, the serialized format is then used.
+  virtual bool deSerializeArrays(std::map<std::string,
+                                          std::pair<double*,size_t>>&)
+  { return false; }
 
   //! \brief Returns reference to a named topology entity.
   const TopEntity& getEntity(const std::string& name) const;
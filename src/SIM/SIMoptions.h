@@ -43,6 +43,8 @@ public:
 
   //! \brief Defines the linear equation solver to be used.
   void setLinearSolver(const std::string& eqsolver);
+  //! \brief Defines the node ordering to use when numbering the equations.
+  bool setEquationOrdering(const std::string& method);
 
   //! \brief Parses a subelement of the \a console XML-tag.
   bool parseConsoleTag(const TiXmlElement* elem);
@@ -60,7 +62,7 @@ public:
   //! \brief Returns \e true if the i'th argument is obsolete.
   static bool ignoreOldOptions(int argc, char** argv, int& i);
 
-  //! \brief Returns whether HDF5 output is requested or not.
+  //! \brief Returns whether HDF5 or VTU output is requested or not.
   bool dumpHDF5(const char* defaultName);
 
   //! \brief Prints out the simulation options to the given stream.
@@ -74,8 +76,11 @@ public:
 
   ASM::Discretization discretization; //!< Spatial discretization option
   LinAlg::MatrixType  solver;         //!< The linear equation solver to use
+  LinAlg::Ordering    ordering;       //!< Node ordering of the equations
 
   int num_threads_SLU; //!< Number of threads for SuperLU_MT
+  bool patchThreads;   //!< If \e true, assemble whole patches concurrently
+  double gpTableSize;  //!< Memory budget (in MB) for Gauss point tables
 
   // Eigenvalue solver options
   int    eig;   //!< Eigensolver method (1,...,5)
@@ -93,7 +98,10 @@ public:
   bool saveLog;  //!< If \e true, export the log
 
   std::string hdf5; //!< Prefix for HDF5-file
+  bool hdf5async;   //!< If \e true, write the HDF5-file in a background thread
+  int  hdf5compress;//!< Compression level of the HDF5 datasets (0 = none)
   std::string vtf;  //!< Prefix for VTF-file
+  std::string vtu;  //!< Prefix for VTU-files
 
   // Restart options
   int         restartInc;  //!< Number of increments between each restart output
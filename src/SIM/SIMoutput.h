@@ -137,6 +137,24 @@ public:
   bool writeGlvS2(const Vector& psol, int iStep, int& nBlock, double time = 0.0,
                   int idBlock = 20, int psolComps = 0);
 
+  //! \brief Writes the tessellated model with results to VTU-files.
+  //! \param[in] psol Primary solution vector
+  //! \param[in] fileName Name prefix of the files to write
+  //! \param[in] time Load/time step parameter
+  //! \param[in] prefix Common prefix for the result array names
+  //! \param[in] secondary If \e true, include the secondary solution
+  //! \param[in] psolComps Optional number of primary solution components
+  //!
+  //! \details Each patch is tessellated, evaluated and written to a separate
+  //! piece file, concurrently over the patches when built with OpenMP,
+  //! such that only the grid blocks of the patches currently being processed
+  //! are kept in memory. A PVTU-file referring all pieces is then written.
+  //! The secondary solution is evaluated one patch at a time, since the
+  //! integrand holds patch-level state.
+  bool writeVTU(const Vector& psol, const std::string& fileName,
+                double time = 0.0, const std::string& prefix = "",
+                bool secondary = true, int psolComps = 0);
+
   //! \brief Evaluates the secondary solution for a given load/time step.
   //! \param[in] psol Primary solution vector
   //! \param[in] time Load/time step parameter
@@ -285,6 +303,11 @@ public:
 
   //! \brief Serialization support.
   virtual bool serialize(std::map<std::string,std::string>&) const;
+  //! \brief Typed restart support, registers the arrays to write.
+  //! \details Not supported by default, the serialized format is then used.
+  virtual bool serializeArrays(std::map<std::string,
+                                        std::pair<double*,size_t>>&) const
+  { return false; }
 
   //! \brief Returns the reference norm to base mesh adaptation upon.
   virtual double getReferenceNorm(const Vectors&, size_t) const = 0;
@@ -53,6 +53,30 @@ protected:
   //! \param[in] name Name of simulator the solution belongs to
   bool restoreSolution(const SerializeMap& data, const std::string& name);
 
+  //! \brief Typed restart data, pointer to and length of each named array.
+  typedef std::map<std::string,std::pair<double*,size_t>> ArrayMap;
+
+  //! \brief Adds the current solution vectors to a typed restart container.
+  //! \param data Container for typed restart data
+  //! \param[in] name Name of simulator the solution belongs to
+  //!
+  //! \details Only references to the solution vectors are stored in \a data,
+  //! such that they can be written to file without copying.
+  bool saveSolution(ArrayMap& data, const std::string& name) const;
+
+  //! \brief Adds the solution vectors to be restored to a typed container.
+  //! \param data Container for typed restart data
+  //! \param[in] name Name of simulator the solution belongs to
+  //!
+  //! \details The solution vectors must have been allocated in advance,
+  //! such that they can be read into directly.
+  bool restoreSolution(ArrayMap& data, const std::string& name);
+
+  //! \brief Returns the typed restart data name of a solution vector.
+  //! \param[in] name Name of simulator the solution belongs to
+  //! \param[in] idx Index of the solution vector
+  static std::string arrayName(const std::string& name, size_t idx);
+
   //! \brief Helper method for serializing a double array into a text string.
   //! \param[in] v Pointer to double array
   //! \param[in] n Length of array
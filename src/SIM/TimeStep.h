@@ -69,6 +69,13 @@ public:
   //! \param[in] data Container for serialized data
   bool deSerialize(const std::map<std::string,std::string>& data);
 
+  //! \brief Stores internal state in a numeric array for restarting purposes.
+  //! \param data Array of internal state values
+  void serialize(std::vector<double>& data) const;
+  //! \brief Set internal state from a numeric array.
+  //! \param[in] data Array of internal state values
+  bool deSerialize(const std::vector<double>& data);
+
   int        step; //!< Time step counter
   int&       iter; //!< Iteration counter
   TimeDomain time; //!< Time domain data
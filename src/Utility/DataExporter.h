@@ -121,6 +121,12 @@ public:
   //! \param[in] geometryUpdated Whether or not geometries are updated
   bool dumpTimeLevel(const TimeStep* tp=nullptr, bool geometryUpdated=false);
 
+  //! \brief Waits until all data writers have completed their pending output.
+  //! \details This must be invoked before the result files are accessed
+  //! by other means, e.g., before writing restart data, when some of the
+  //! writers write their output asynchronously.
+  void sync();
+
   //! \brief Returns the current time level of the exporter.
   int getTimeLevel();
 
@@ -192,6 +198,9 @@ public:
   //! \param[in] level Level we just wrote to the file
   virtual void closeFile(int level) = 0;
 
+  //! \brief Waits until pending output has been written to file.
+  virtual void sync() {}
+
   //! \brief Writes a vector to file.
   //! \param[in] level The time level to write the vector at
   //! \param[in] entry The DataEntry describing the vector
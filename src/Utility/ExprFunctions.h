@@ -27,6 +27,7 @@ namespace ExprEval {
   class Expression;
   class FunctionList;
   class ValueList;
+  class Program;
 }
 
 
@@ -42,6 +43,8 @@ class EvalFunc : public ScalarFunc
 
   std::vector<Real*> arg; //!< Function argument values
 
+  ExprEval::Program* prog; //!< Compiled expression, stateless and thread-safe
+
   EvalFunc* gradient; //!< First derivative expression
 
   Real dx; //!< Domain increment for calculation of numerical derivative
@@ -70,6 +73,8 @@ protected:
   EvalFunc& operator=(const EvalFunc&) = delete;
   //! \brief Evaluates the function expression.
   virtual Real evaluate(const Real& x) const;
+  //! \brief Evaluates the function expression tree of thread \a i.
+  Real interpret(size_t i, Real x) const;
 
   //! \brief Cleans up the allocated data.
   void cleanup();
@@ -97,6 +102,8 @@ class EvalFunction : public RealFunc
 
   std::vector<Arg> arg; //!< Function argument values
 
+  ExprEval::Program* prog; //!< Compiled expression, stateless and thread-safe
+
   std::array<EvalFunction*,3> gradient;  //!< First derivative expressions
   std::array<EvalFunction*,6> dgradient; //!< Second derivative expressions
 
@@ -116,10 +123,15 @@ public:
   virtual bool isConstant() const { return IAmConstant; }
 
   //! \brief Returns first-derivative of the function.
+  //! \details If no derivative expression is specified, the derivative is
+  //! obtained by automatic differentiation of the compiled expression.
   virtual Real deriv(const Vec3& X, int dir) const;
   //! \brief Returns second-derivative of the function.
   virtual Real dderiv(const Vec3& X, int dir1, int dir2) const;
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Non-implemented copy constructor to disallow copying.
   EvalFunction(const EvalFunction&) = delete;
@@ -127,6 +139,8 @@ protected:
   EvalFunction& operator=(const EvalFunction&) = delete;
   //! \brief Evaluates the function expression.
   virtual Real evaluate(const Vec3& X) const;
+  //! \brief Evaluates the function expression tree of thread \a i.
+  Real interpret(size_t i, const Real* X) const;
 
   //! \brief Cleans up the allocated data.
   void cleanup();
@@ -191,6 +205,12 @@ public:
   //! \brief Returns second-derivative of the function.
   virtual Ret dderiv(const Vec3& X, int dir1, int dir2) const;
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const
+  {
+    this->ParentFunc::getValues(X,values);
+  }
+
 protected:
   //! \brief Sets the number of spatial dimensions (default implementation).
   void setNoDims() { ParentFunc::ncmp = nsd = p.size(); }
@@ -208,6 +228,9 @@ typedef EvalMultiFunction<STensorFunc,SymmTensor> STensorFuncExpr;
 
 //! \brief Specialization for vector functions.
 template<> Vec3 VecFuncExpr::evaluate(const Vec3& X) const;
+//! \brief Specialization for vector functions.
+template<> void VecFuncExpr::getValues(const PointArray& X,
+                                       std::vector<Real>& values) const;
 
 //! \brief Specialization for tensor functions.
 template<> void TensorFuncExpr::setNoDims();
@@ -16,6 +16,10 @@
 
 #include "TensorFunction.h"
 #include <string>
+#include <map>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 class Field;
 class Fields;
@@ -35,15 +39,13 @@ protected:
   FieldFuncBase() : pidx(0), npch(0) {}
   //! \brief No copying of this class.
   FieldFuncBase(const FieldFuncBase&) = delete;
-  //! \brief The destructor deletes the patches.
-  virtual ~FieldFuncBase();
+  //! \brief Empty destructor.
+  virtual ~FieldFuncBase() {}
 
   //! \brief Sets the active patch.
   bool setPatch(size_t pIdx);
 
 protected:
-  std::vector<ASMbase*> patch; //!< The patches on which the field is defined
-
   size_t pidx; //!< Current patch index
   size_t npch; //!< Number of patches in the field
 };
@@ -51,17 +53,43 @@ protected:
 
 /*!
   \brief Base class for spatial functions, defined from a HDF5-file.
+  \details If the HDF5-file contains several time levels, an index of the
+  time of each level is read when the file is opened, and the field values
+  are updated whenever the field is evaluated at another time. The values are
+  either taken from the level closest in time, or interpolated in time from
+  the surrounding levels, provided that these levels share the same basis.
+  The levels in use are cached in memory, and the next level is read in a
+  background thread while the current ones are being used, provided that the
+  HDF5 library is built thread-safe.
+
+  Evaluation at the time the field already is updated to is read-only and
+  thread-safe. The update itself is guarded by a mutex, such that it is done
+  by one thread only when several threads request the same new time, as in
+  multi-threaded assembly loops. Concurrent evaluation at different times is
+  not supported.
 */
 
 class FieldFuncHDF5 : public FieldFuncBase
 {
+public:
+  //! \brief Interpolation methods between the time levels of the field.
+  enum Interpolation
+  {
+    NEAREST, //!< Use the level closest in time
+    LINEAR,  //!< Linear interpolation between the two bracketing levels
+    CUBIC    //!< Cubic interpolation through the four surrounding levels
+  };
+
+  //! \brief Defines the interpolation method between the time levels.
+  void setInterpolation(Interpolation method) { interpol = method; }
+
 protected:
   //! \brief The constructor opens the provided HDF5-file.
   //! \param[in] fileName Name of the HDF5-file
   explicit FieldFuncHDF5(const std::string& fileName);
   //! \brief No copying of this class.
   FieldFuncHDF5(const FieldFuncHDF5&) = delete;
-  //! \brief The destructor closes the HDF5-file.
+  //! \brief The destructor closes the HDF5-file and deletes the bases.
   virtual ~FieldFuncHDF5();
 
   //! \brief Loads field values for the specified time level.
@@ -73,6 +101,11 @@ protected:
             const std::string& basisName, int level,
             bool isScalar = false);
 
+  //! \brief Updates the field values to the specified time.
+  //! \param[in] time The time to evaluate the field at
+  //! \return \e false if the field values could not be read
+  bool setTime(double time);
+
   //! \brief Finds the level whose time is closest to the specified time.
   int findClosestLevel(double time) const;
 
@@ -84,11 +117,57 @@ protected:
   virtual void clearField() = 0;
 
 private:
+  //! \brief Struct with the field coefficients of a time level.
+  struct Level
+  {
+    int basis = -1; //!< The time level holding the basis of the field
+    std::vector<std::vector<Real>> coefs; //!< Field coefficients of patches
+  };
+
+  //! \brief Weighted time levels defining the current field values.
+  typedef std::vector<std::pair<int,double>> Stencil;
+
+  //! \brief Reads the field coefficients of a time level.
+  bool readLevel(int level, Level& data);
+  //! \brief Reads the basis of a time level and sizes its coefficient array.
+  bool readLevelBasis(int level, Level& data);
+  //! \brief Reads the field coefficients of a time level with known basis.
+  //! \details This method is also executed by the background thread.
+  //! It only reads from the HDF5-file, and does not modify any members.
+  bool readCoefs(int level, Level& data) const;
+  //! \brief Reads the basis of the field at a time level.
+  //! \return The time level holding the basis, or -1 if no basis was found
+  int readBasis(int level, size_t nPatches);
+  //! \brief Returns the field coefficients of a time level, reading if needed.
+  const Level* getLevel(int level);
+  //! \brief Waits for the background thread to finish.
+  void sync();
+  //! \brief Returns the weighted time levels to use for the given time.
+  Stencil getStencil(double time) const;
+  //! \brief Defines the field values from the given time levels.
+  bool setField(const Stencil& levels);
+
   HDF5Reader* hdf5; //!< The HDF5-file containing the field data
   ProcessAdm* pAdm; //!< Process administrator for the HDF5-file reader
 
-  mutable int    lastLevel; //!< The last time level read from
-  mutable double lastTime;  //!< The time of \a lastLevel
+  std::vector<std::string> fNames; //!< Name of the field components
+  std::string              bName;  //!< Name of the basis
+  bool                     scalar; //!< If \e true, this is a scalar field
+  Interpolation          interpol; //!< Interpolation method in time
+
+  std::vector<double>      times;  //!< Time of each level in the HDF5-file
+  std::map<int,Level>      cache;  //!< Cached time levels
+  std::map<int,int>        basisOf; //!< Time level holding the basis of levels
+  std::map<int,std::vector<ASMbase*>> bases; //!< Bases of the field
+
+  Stencil             current; //!< Time levels of the current field values
+  std::atomic<double> curTime; //!< Time of the current field values
+  std::mutex          mutex;   //!< Guards the update of the field values
+
+  std::thread worker;    //!< Background thread reading the next time level
+  int         nextLevel; //!< The time level read by the background thread
+  bool        nextOK;    //!< If \e true, the next time level was read
+  Level       next;      //!< Field coefficients read by the background thread
 };
 
 
@@ -114,6 +193,8 @@ public:
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
 
+  using FieldFuncHDF5::setInterpolation;
+
 protected:
   //! \brief Evaluates the scalar field function.
   virtual Real evaluate(const Vec3& X) const;
@@ -126,11 +207,6 @@ protected:
   virtual void clearField();
 
 private:
-  mutable int currentLevel; //!< Current time level to evaluate at
-
-  std::string fName; //!< Name of field
-  std::string bName; //!< Name of basis
-
   std::vector<Field*> field; //!< The scalar field to be evaluated
 };
 
@@ -191,13 +267,6 @@ protected:
   //! \brief Evaluates the field at the givent point \b X.
   std::vector<Real> getValues(const Vec3& X);
 
-private:
-  mutable int currentLevel; //!< Current time level to evaluate at
-
-protected:
-  std::vector<std::string> fName; //!< Name of field components
-  std::string              bName; //!< Name of basis
-
   std::vector<Fields*> field; //!< The vector field to be evaluated
 };
 
@@ -224,6 +293,8 @@ public:
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
 
+  using FieldFuncHDF5::setInterpolation;
+
 protected:
   //! \brief Evaluates the vectorial field function.
   virtual Vec3 evaluate(const Vec3& X) const;
@@ -252,6 +323,8 @@ public:
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
 
+  using FieldFuncHDF5::setInterpolation;
+
 protected:
   //! \brief Evaluates the tensorial field function.
   virtual Tensor evaluate(const Vec3& X) const;
@@ -280,6 +353,8 @@ public:
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
 
+  using FieldFuncHDF5::setInterpolation;
+
 protected:
   //! \brief Evaluates the tensorial field function.
   virtual SymmTensor evaluate(const Vec3& X) const;
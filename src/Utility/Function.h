@@ -136,6 +136,29 @@ public:
 };
 
 
+/*!
+  \brief A batch of spatial points, stored as separate coordinate arrays.
+  \details Used for evaluating spatial functions in many points in one call.
+*/
+
+struct PointArray
+{
+  std::vector<Real> x; //!< X-coordinates of the points
+  std::vector<Real> y; //!< Y-coordinates of the points
+  std::vector<Real> z; //!< Z-coordinates of the points
+  Real              t; //!< Time, common for all points
+
+  //! \brief Constructor allocating space for \a n points.
+  explicit PointArray(size_t n = 0, Real time = Real(0))
+    : x(n,Real(0)), y(n,Real(0)), z(n,Real(0)), t(time) {}
+
+  //! \brief Returns the number of points.
+  size_t size() const { return x.size(); }
+  //! \brief Returns point \a i (0-based index) with time.
+  Vec4 operator[](size_t i) const { return Vec4(x[i],y[i],z[i],t); }
+};
+
+
 /*!
   \brief Base class for unary spatial functions of arbitrary result type.
   \details Includes an interface for returning the function value as an array.
@@ -159,6 +182,11 @@ public:
   //! \brief Returns a representative scalar equivalent of the function value.
   virtual Real getScalarValue(const Vec3&) const = 0;
 
+  //! \brief Returns the function values in a batch of points.
+  //! \param[in] X The points (and time) to evaluate the function at
+  //! \param[out] values The function values, dim() components for each point
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
   //! \brief Returns the number of components of the return value.
   size_t dim() const { return ncmp; }
 
@@ -198,6 +226,9 @@ public:
 
   //! \brief Returns a representative scalar equivalent of the function value.
   virtual Real getScalarValue(const Vec3& X) const { return this->evaluate(X); }
+
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
 };
 
 
@@ -232,6 +263,9 @@ public:
   {
     return this->evaluate(X).length();
   }
+
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
 };
 
 
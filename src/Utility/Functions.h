@@ -174,6 +174,9 @@ public:
   //! \brief Returns whether the function is identically zero or not.
   virtual bool isZero() const { return fval == Real(0); }
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the constant function.
   virtual Real evaluate(const Vec3&) const { return fval; }
@@ -257,6 +260,9 @@ public:
   //! \brief Returns first-derivative of the function.
   virtual Real deriv(const Vec3&, int dir) const;
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the linear function.
   virtual Real evaluate(const Vec3& X) const;
@@ -282,6 +288,9 @@ public:
   //! \brief Returns first-derivative of the function.
   virtual Real deriv(const Vec3&, int dir) const;
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the linear function.
   virtual Real evaluate(const Vec3& X) const;
@@ -307,6 +316,9 @@ public:
   //! \brief Returns first-derivative of the function.
   virtual Real deriv(const Vec3&, int dir) const;
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the linear function.
   virtual Real evaluate(const Vec3& X) const;
@@ -335,6 +347,9 @@ public:
   //! \brief Returns second-derivative of the function.
   virtual Real dderiv(const Vec3&, int dir1, int dir2) const;
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the quadratic function.
   virtual Real evaluate(const Vec3& X) const;
@@ -363,6 +378,9 @@ public:
   //! \brief Returns second-derivative of the function.
   virtual Real dderiv(const Vec3&, int dir1, int dir2) const;
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the quadratic function.
   virtual Real evaluate(const Vec3& X) const;
@@ -391,6 +409,9 @@ public:
   //! \brief Returns second-derivative of the function.
   virtual Real dderiv(const Vec3&, int dir1, int dir2) const;
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the quadratic function.
   virtual Real evaluate(const Vec3& X) const;
@@ -512,6 +533,9 @@ public:
   //! \brief Returns whether the function is time-independent or not.
   virtual bool isConstant() const { return time <= Real(0) || grid.size() < 2; }
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the function by interpolating the 1D grid.
   virtual Real evaluate(const Vec3& X) const;
@@ -533,6 +557,9 @@ public:
   //! \brief Returns whether the function is identically zero or not.
   virtual bool isZero() const { return fval.isZero(0.0); }
 
+  //! \brief Returns the function values in a batch of points.
+  virtual void getValues(const PointArray& X, std::vector<Real>& values) const;
+
 protected:
   //! \brief Evaluates the constant function.
   virtual Vec3 evaluate(const Vec3&) const { return fval; }
@@ -36,6 +36,11 @@ public:
   //! \brief The destructor closes the file.
   virtual ~HDF5Base() { this->closeFile(); }
 
+  //! \brief Returns \e true if the HDF5 library is built thread-safe.
+  //! \details Only then may the library be used from background threads,
+  //! while other threads are accessing HDF5 files concurrently.
+  static bool threadSafe();
+
 protected:
   //! \brief Opens the HDF5 file.
   //! \param[in] flag Mode to open file using
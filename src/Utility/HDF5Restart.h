@@ -26,12 +26,21 @@ class TimeStep;
   \details The HDF5 restart hanlder writes and reads data using a HDF5 file.
   It supports parallel I/O, and can be used to add restart capability
   to applications.
+
+  Two formats are supported. The serialized format stores one byte string
+  per process for each named entry. The typed format stores each named
+  numeric array as one global dataset of doubles, where each process owns
+  a contiguous hyperslab. The typed arrays are written directly from, and
+  read directly into, the storage of the application (e.g., the solution
+  vectors) using collective I/O, such that no intermediate copies are made.
 */
 
 class HDF5Restart : public HDF5Base
 {
 public:
   typedef std::map<std::string,std::string> SerializeData; //!< Convenience type
+  //! \brief Typed restart data, pointer to and length of each named array.
+  typedef std::map<std::string,std::pair<double*,size_t>> ArrayData;
 
   //! \brief The constructor opens a named HDF5-file.
   //! \param[in] name The name (without extension) of the data file
@@ -54,7 +63,31 @@ public:
   //! \returns Negative value on error, else restart level loaded
   int readData(SerializeData& data, int level = -1);
 
+  //! \brief Writes typed restart data to file.
+  //! \param[in] tp Time stepping information
+  //! \param[in] data Arrays to write
+  //!
+  //! \details All processes must provide the same array names, whereas the
+  //! array lengths may differ. The time stepping information is stored
+  //! together with the arrays, and need not be added to \a data.
+  bool writeData(const TimeStep& tp, const ArrayData& data);
+
+  //! \brief Reads typed restart data from file.
+  //! \param data Arrays to read into (assumed allocated outside)
+  //! \param[in] level Level to read (-1 to read last level in file)
+  //! \param[out] tp Time stepping information (ignored if null)
+  //! \returns Negative value on error, else restart level loaded
+  int readData(ArrayData& data, int level = -1, TimeStep* tp = nullptr);
+
+  //! \brief Checks whether the file contains typed restart data.
+  //! \param[in] level Level to check (-1 to check last level in file)
+  bool hasArrayData(int level = -1);
+
 private:
+  //! \brief Returns the actual level to read restart data from.
+  //! \param[in] level Requested level (-1 for last level in file)
+  int getLevel(int level) const;
+
   int m_stride; //!< Stride between outputs
 };
 
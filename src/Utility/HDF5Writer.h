@@ -16,6 +16,10 @@
 
 #include "DataExporter.h"
 #include "HDF5Base.h"
+#ifdef HAS_HDF5
+#include <thread>
+#include <map>
+#endif
 
 class SIMbase;
 
@@ -24,6 +28,14 @@ class SIMbase;
   \brief Write data to a HDF5 file.
 
   \details The HDF5 writer writes data to a HDF5 file. It supports parallel I/O.
+
+  In serial runs, the output may be written asynchronously (see setAsync).
+  The data of a time level is then copied into a memory buffer as the level
+  is written, and the buffer is flushed to file by a background thread when
+  the file is closed. While a level is being flushed, the next one is buffered
+  (double buffering), such that at most two time levels are kept in memory.
+  The simulation waits for the previous flush only when the next level is
+  closed, or when sync() is invoked.
 */
 
 class HDF5Writer : public DataWriter, public HDF5Base
@@ -36,8 +48,24 @@ public:
   HDF5Writer(const std::string& name, const ProcessAdm& adm,
              bool append = false);
 
-  //! \brief Empty destructor.
-  virtual ~HDF5Writer() {}
+  //! \brief The destructor waits for pending output to be written.
+  virtual ~HDF5Writer();
+
+  //! \brief Enables or disables asynchronous output.
+  //! \details This is ignored in parallel runs, and if the HDF5 library is
+  //! not thread-safe, since other parts of the simulator (field functions,
+  //! restart files) may access HDF5 while a time level is being flushed.
+  void setAsync(bool enable);
+  //! \brief Defines chunking and compression of the datasets.
+  //! \param[in] level Deflate compression level (0 = no compression)
+  //! \param[in] chunk Maximum number of elements in each dataset chunk
+  //!
+  //! \details This is ignored in parallel runs.
+  //! No chunking is used if \a level is zero and \a chunk is zero.
+  void setCompression(int level, int chunk = 65536);
+
+  //! \brief Waits until all pending output has been written to file.
+  virtual void sync();
 
   //! \brief Returns the last time level stored in the HDF5 file.
   virtual int getLastTimeLevel();
@@ -106,9 +134,21 @@ protected:
   //! \param[in] len The length of the array
   //! \param[in] data The array to write
   //! \param[in] type The HDF5 type for the data (see H5T)
+  //!
+  //! \details In asynchronous mode, the data is copied into the buffer of
+  //! the current time level, to be written when the file is closed.
   void writeArray(hid_t group, const std::string& name,
                   int patch, int len, const void* data, hid_t type);
 
+  //! \brief Opens a group in the file, or creates it if it does not exist.
+  //! \param[in] path Path of the group
+  //! \return A handle to the group, to be released by closeGroup
+  //!
+  //! \details In asynchronous mode, a placeholder handle is returned.
+  hid_t openGroup(const std::string& path);
+  //! \brief Closes a group opened by openGroup.
+  void closeGroup(hid_t group);
+
   //! \brief Internal helper function writing a SIM's basis (geometry) to file.
   //! \param[in] SIM The SIM we want to write basis for
   //! \param[in] name The name of the basis
@@ -121,7 +161,61 @@ protected:
                   bool l2g = false);
 
 private:
+  //! \brief Opens a group in a HDF5 file, or creates it if it does not exist.
+  static hid_t openGroup(hid_t file, const std::string& path);
+
+  //! \brief Writes a data array into a new dataset.
+  //! \param[in] group The HDF5 group to write data into
+  //! \param[in] name The name of the array
+  //! \param[in] patch Patch number of the array
+  //! \param[in] siz Total size of the dataset
+  //! \param[in] start Offset of this process' data in the dataset
+  //! \param[in] len The length of the array
+  //! \param[in] data The array to write
+  //! \param[in] type The HDF5 type for the data (see H5T)
+  void writeDataset(hid_t group, const std::string& name, int patch,
+                    hsize_t siz, hsize_t start, hsize_t len,
+                    const void* data, hid_t type) const;
+
+  //! \brief Writes the buffered time level to file.
+  //! \details This method is executed by the background thread.
+  void flushLevel();
+
+  /*!
+    \brief Struct with a buffered group or data array.
+  */
+  struct Dataset
+  {
+    size_t group;      //!< Index of the group path in the time level
+    std::string name;  //!< The name of the array (empty for a group only)
+    int patch;         //!< Patch number of the array
+    hsize_t siz;       //!< Total size of the dataset
+    hsize_t start;     //!< Offset of this process' data in the dataset
+    hsize_t len;       //!< The length of the array
+    hid_t type;        //!< The HDF5 type for the data
+    std::vector<char> data; //!< Copy of the array
+  };
+
+  /*!
+    \brief Struct with the buffered output of a time level.
+  */
+  struct Level
+  {
+    unsigned int flag;               //!< The file flags to open the file with
+    std::vector<std::string> groups; //!< Paths of the groups used
+    std::map<std::string,size_t> groupIdx; //!< Group path to index mapping
+    std::vector<Dataset> data;       //!< The data arrays to write
+  };
+
   unsigned int m_flag; //!< The file flags to open HDF5 file with
+
+  bool        m_async;    //!< If \e true, write output in a background thread
+  bool        m_buffering;//!< If \e true, a time level is being buffered
+  int         m_compress; //!< Deflate compression level of the datasets
+  hsize_t     m_chunk;    //!< Maximum chunk size of the datasets
+  Level       m_pending;  //!< The time level currently being buffered
+  Level       m_flushing; //!< The time level being written to file
+  std::thread m_worker;   //!< The background writer thread
 #endif
 };
 
@@ -31,6 +31,17 @@
 
   The profiling results are printed in a nicely formatted table when the
   profiler object goes out of scope, typically at the end of the program.
+
+  The task names are interned into integer labels, such that the profiling
+  macros only need a name lookup the first time each scope is entered.
+  The timings are kept in separate buffers for each thread, which are only
+  accessed by the owning thread, and thus need no locking. In addition to
+  the flat per-task timings, the nesting of the tasks is recorded as a call
+  tree for each thread. If \ref exportName is set, the call trees are printed
+  and written as folded stacks (for flame graph tools) when the profiler goes
+  out of scope. If \ref recordTrace is set, each task invokation is also
+  recorded and written as a Chrome trace file (JSON), for inspection in a
+  trace viewer.
 */
 
 class Profiler
@@ -46,15 +57,36 @@ public:
   //! \brief The destructor prints the profiling report to the console.
   ~Profiler();
 
+  //! \brief Returns the integer label of the task \a funcName.
+  //! \details The label is created on the first invokation for each name.
+  static size_t getLabel(const char* funcName);
+
   //! \brief Starts profiling of task \a funcName and increments \a nRunners.
-  void start(const std::string& funcName);
+  void start(const std::string& funcName)
+  { this->start(getLabel(funcName.c_str())); }
   //! \brief Stops profiling of task \a funcName and decrements \a nRunners.
-  void stop(const std::string& funcName);
+  void stop(const std::string& funcName)
+  { this->stop(getLabel(funcName.c_str())); }
+
+  //! \brief Starts profiling of the task with the given label.
+  void start(size_t label);
+  //! \brief Stops profiling of the task with the given label.
+  void stop(size_t label);
 
   //! \brief Prints a profiling report for all tasks that have been measured.
   void report(std::ostream& os) const;
+  //! \brief Prints the call tree of the measured tasks for each thread.
+  void reportTree(std::ostream& os) const;
+
+  //! \brief Writes the call trees as folded stacks.
+  //! \details Each line contains the semicolon-separated task names of a
+  //! call path, followed by the self time of the path in microseconds.
+  bool writeFolded(const std::string& fileName) const;
+  //! \brief Writes the recorded task invokations in Chrome trace format.
+  bool writeTrace(const std::string& fileName) const;
+
   //! \brief Clears the profiler.
-  void clear() { myTimers.clear(); allCPU = allWall = 0.0; nRunners = 0; }
+  void clear();
 
 private:
   //! \brief Stores profiling data for one computational task.
@@ -77,12 +109,53 @@ private:
   //! \brief Global stream operator printing a Profile instance.
   friend std::ostream& operator<<(std::ostream& os, const Profile& p);
 
-  std::string myName; //!< Name of this profiler
+  //! \brief Node in the call tree of a thread.
+  struct TreeNode
+  {
+    size_t label;     //!< Task label of this node
+    int    parent;    //!< Index of the parent node (-1 for the root)
+    double totalWall; //!< Total wall clock time consumed in this node
+    size_t nCalls;    //!< Number of invokations of this node
+    std::vector<int> children; //!< Indices of the child nodes
+  };
+
+  //! \brief A recorded task invokation.
+  struct TraceEvent
+  {
+    size_t label; //!< Task label
+    double start; //!< Starting wall clock time
+    double stop;  //!< Stopping wall clock time
+  };
 
-  typedef std::map<std::string,Profile> ProfileMap; //!< Map of profilers
+  //! \brief Profiling data of one thread.
+  struct ThreadData
+  {
+    std::vector<Profile>    timers; //!< Task profiles indexed on label
+    std::vector<TreeNode>   tree;   //!< Call tree, with the root node first
+    std::vector<int>        stack;  //!< Tree nodes of the running tasks
+    std::vector<TraceEvent> events; //!< Recorded task invokations
+    size_t                  lost;   //!< Number of events not recorded
+
+    //! \brief The constructor initializes the call tree.
+    ThreadData() { this->clear(); }
+    //! \brief Clears the profiling data.
+    void clear();
+  };
 
-  ProfileMap              myTimers;  //!< The task profiles with names
-  std::vector<ProfileMap> myMTimers; //!< Task profiles with names and thread iD
+  //! \brief Returns the profiling data of the calling thread.
+  ThreadData* getData();
+  //! \brief Prints the call tree below the given node.
+  void printTree(std::ostream& os, const ThreadData& data,
+                 int node, int level) const;
+  //! \brief Writes the folded stacks below the given node.
+  void printFolded(std::ostream& os, const ThreadData& data,
+                   int node, const std::string& path) const;
+
+  std::string myName; //!< Name of this profiler
+  double      myT0;   //!< Wall clock time at construction
+
+  ThreadData              myTimers;  //!< The task profiles of the main thread
+  std::vector<ThreadData> myMTimers; //!< Task profiles of each OpenMP thread
 
   double allCPU;  //!< Accumulated CPU time from all "main" tasks
   double allWall; //!< Accumulated wall clock time of all "main" tasks
@@ -94,6 +167,11 @@ private:
   //! the measured task is already included in another "main" task,
   //! and therefore its time is not included when calculating the "other" times.
   size_t nRunners; //!< Number of tasks currently running
+
+public:
+  static std::string exportName;  //!< Prefix of the call tree/trace files
+  static bool        recordTrace; //!< If \e true, record task invokations
+  static size_t      maxEvents;   //!< Maximum number of events per thread
 };
 
 
@@ -104,18 +182,25 @@ namespace utl
   //! \brief Convenience class to profile the local scope.
   class prof
   {
-    const char* name; //!< Name tag on the local scope to profile
+    size_t label; //!< Label of the local scope to profile
   public:
     //! \brief The constructor starts the profiling of the named task.
-    explicit prof(const char* tag) : name(tag) { if (profiler) profiler->start(name); }
+    explicit prof(const char* tag) : label(Profiler::getLabel(tag))
+    { if (profiler) profiler->start(label); }
+    //! \brief The constructor starts the profiling of the labeled task.
+    explicit prof(size_t id) : label(id)
+    { if (profiler) profiler->start(label); }
     //! \brief The destructor stops the profiling.
-    ~prof() { if (profiler) profiler->stop(name); }
+    ~prof() { if (profiler) profiler->stop(label); }
   };
 }
 
 
 //! \brief Macro to add profiling of the local scope.
-#define PROFILE(label) utl::prof _prof(label)
+//! \details The label is looked up only the first time the scope is entered.
+#define PROFILE(label) \
+  static const size_t _profID = Profiler::getLabel(label); \
+  utl::prof _prof(_profID)
 
 #if PROFILE_LEVEL >= 1
 #define PROFILE1(label) PROFILE(label)
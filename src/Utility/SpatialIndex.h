@@ -0,0 +1,132 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SpatialIndex.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Bounding volume hierarchy and grid hashing for spatial point queries.
+//!
+//==============================================================================
+
+#ifndef _SPATIAL_INDEX_H
+#define _SPATIAL_INDEX_H
+
+#include <vector>
+#include <cstddef>
+
+class Vec3;
+
+
+/*!
+  \brief Bounding volume hierarchy of axis-aligned boxes.
+  \details Each item is an axis-aligned bounding box with an integer
+  identifier, e.g., an element bounding box or a nodal point (degenerated
+  box). The items are sorted into a binary tree by recursive median splits
+  along the longest box axis, such that the items containing a point, or
+  the item closest to a point, are found in logarithmic time.
+*/
+
+class SpatialIndex
+{
+public:
+  //! \brief Default constructor.
+  SpatialIndex() {}
+
+  //! \brief Erases all items and the tree.
+  void clear();
+  //! \brief Returns \e true if the index has no items.
+  bool empty() const { return items.empty(); }
+  //! \brief Returns the number of items in the index.
+  size_t size() const { return items.size(); }
+
+  //! \brief Adds a point item to the index.
+  //! \param[in] id Item identifier
+  //! \param[in] X Spatial coordinates of the point
+  void add(int id, const Vec3& X) { this->add(id,X,X); }
+  //! \brief Adds a box item to the index.
+  //! \param[in] id Item identifier
+  //! \param[in] Xmin Lower corner of the bounding box
+  //! \param[in] Xmax Upper corner of the bounding box
+  void add(int id, const Vec3& Xmin, const Vec3& Xmax);
+
+  //! \brief Builds the tree after all items have been added.
+  //! \param[in] leafSize Maximum number of items in each leaf
+  void build(size_t leafSize = 8);
+
+  //! \brief Finds the items with a bounding box containing a given point.
+  //! \param[in] X Spatial coordinates of the point
+  //! \param[out] ids Identifiers of the items containing the point
+  //! \param[in] tol Tolerance to extend each bounding box with
+  void findContaining(const Vec3& X, std::vector<int>& ids,
+                      double tol = 0.0) const;
+
+  //! \brief Finds the item that is closest to a given point.
+  //! \param[in] X Spatial coordinates of the point
+  //! \param[out] dist Distance from the point to the closest item
+  //! \return Identifier of the closest item, -1 if the index is empty
+  int findClosest(const Vec3& X, double* dist = nullptr) const;
+
+  //! \brief Returns the bounding box of all items.
+  //! \param[out] Xmin Lower corner of the bounding box
+  //! \param[out] Xmax Upper corner of the bounding box
+  bool getBoundingBox(Vec3& Xmin, Vec3& Xmax) const;
+
+  //! \brief Finds coinciding points within a given tolerance.
+  //! \param[in] X Spatial coordinates of the points
+  //! \param[in] tol Two points coincide if none of their coordinates differ
+  //! by more than this value (the same criterion as in Vec3::equal)
+  //! \param[out] master Index of the point that each point is merged into,
+  //! or the index of the point itself if it is not merged
+  //! \return Number of points that are merged into another point
+  //!
+  //! \details Each point is merged into the first preceding unmerged point
+  //! it coincides with, such that the result is deterministic and independent
+  //! of the number of threads. The points are hashed into a uniform grid with
+  //! cell size \a tol, such that only points in the neighboring grid cells
+  //! need to be compared, and the neighbor searches are done in parallel.
+  static size_t findDuplicates(const std::vector<Vec3>& X, double tol,
+                               std::vector<int>& master);
+
+private:
+  //! \brief Axis-aligned bounding box.
+  struct Box
+  {
+    double lo[3]; //!< Lower corner
+    double hi[3]; //!< Upper corner
+
+    //! \brief Returns the squared distance from a point to this box.
+    double distance2(const double* X) const;
+    //! \brief Checks whether a point is within the box, with tolerance.
+    bool contains(const double* X, double tol) const;
+  };
+
+  //! \brief Spatial item with an identifier.
+  struct Item
+  {
+    Box box; //!< Bounding box of the item
+    int id;  //!< Item identifier
+  };
+
+  //! \brief Tree node.
+  struct Node
+  {
+    Box box;   //!< Bounding box of all items in this node
+    int first; //!< Index of first item in this node
+    int last;  //!< Index of one-past-last item in this node
+    int left;  //!< Index of the left child node (-1 for leaf nodes)
+    int right; //!< Index of the right child node (-1 for leaf nodes)
+  };
+
+  //! \brief Recursively builds the tree for a range of items.
+  int buildNode(int first, int last, size_t leafSize);
+  //! \brief Recursive closest-item search.
+  void findClosest(int node, const double* X, int& best, double& d2) const;
+
+  std::vector<Item> items; //!< The spatial items, sorted in tree order
+  std::vector<Node> nodes; //!< The tree nodes, the root first
+};
+
+#endif
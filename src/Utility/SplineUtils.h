@@ -22,9 +22,11 @@ class Vec3;
 
 namespace Go {
   class Point;
+  struct BasisPtsSf;
   struct BasisDerivsSf;
   struct BasisDerivsSf2;
   struct BasisDerivsSf3;
+  struct BasisPts;
   struct BasisDerivs;
   struct BasisDerivs2;
   class SplineCurve;
@@ -41,11 +43,37 @@ namespace SplineUtils //! Various utility functions on spline objects.
   Vec4 toVec4(const Go::Point& X, Real time = Real(0));
 
   //! \brief Evaluates given spline curve at a parametric point.
-  void point(Vec3& X, double u, Go::SplineCurve* curve);
+  void point(Vec3& X, double u, const Go::SplineCurve* curve);
   //! \brief Evaluates given spline surface at a parametric point.
-  void point(Vec3& X, double u, double v, Go::SplineSurface* surf);
+  void point(Vec3& X, double u, double v, const Go::SplineSurface* surf);
   //! \brief Evaluates given spline colume at a parametric point.
-  void point(Vec3& X, double u, double v, double w, Go::SplineVolume* vol);
+  void point(Vec3& X, double u, double v, double w,
+             const Go::SplineVolume* vol);
+
+  //! \brief Evaluates the basis functions of a spline curve.
+  //! \details Contrary to the GoTools methods, this and the following
+  //! computeBasis() methods do not modify any internal state of the spline
+  //! object and can therefore safely be invoked from multiple threads.
+  void computeBasis(const Go::SplineCurve* curve, double u,
+                    RealArray& N, RealArray& dNdu, RealArray* d2Ndu2 = nullptr);
+  //! \brief Evaluates the basis functions of a spline surface.
+  void computeBasis(const Go::SplineSurface* surf, double u, double v,
+                    Go::BasisPtsSf& spline);
+  //! \brief Evaluates the basis functions and 1st derivatives of a surface.
+  void computeBasis(const Go::SplineSurface* surf, double u, double v,
+                    Go::BasisDerivsSf& spline);
+  //! \brief Evaluates the basis functions, 1st and 2nd derivatives of a surface.
+  void computeBasis(const Go::SplineSurface* surf, double u, double v,
+                    Go::BasisDerivsSf2& spline);
+  //! \brief Evaluates the basis functions of a spline volume.
+  void computeBasis(const Go::SplineVolume* vol, double u, double v, double w,
+                    Go::BasisPts& spline);
+  //! \brief Evaluates the basis functions and 1st derivatives of a volume.
+  void computeBasis(const Go::SplineVolume* vol, double u, double v, double w,
+                    Go::BasisDerivs& spline);
+  //! \brief Evaluates the basis functions, 1st and 2nd derivatives of a volume.
+  void computeBasis(const Go::SplineVolume* vol, double u, double v, double w,
+                    Go::BasisDerivs2& spline);
 
   //! \brief Establishes matrices with basis functions and 1st derivatives.
   void extractBasis(const Go::BasisDerivsSf& spline,
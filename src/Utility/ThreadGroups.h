@@ -16,6 +16,7 @@
 
 #include <vector>
 #include <cstddef>
+#include <iosfwd>
 
 
 /*!
@@ -86,6 +87,24 @@ public:
   //! \brief Filters current threading groups through a white-list of elements.
   ThreadGroups filter(const IntVec& elmList) const;
 
+  //! \brief Sorts the element tasks of each group on decreasing work load.
+  //! \param[in] cost Estimated work load of each element
+  //! \details Since the tasks of a group are distributed dynamically over the
+  //! available threads, starting with the most expensive tasks reduces the
+  //! idle time at the end of each group.
+  void sortTasks(const std::vector<double>& cost);
+
+  //! \brief Returns the chunk size for dynamic scheduling of element loops.
+  //! \param[in] nel Number of elements in the loop
+  static int chunkSize(size_t nel);
+
+  //! \brief Returns the index of the calling thread.
+  //! \details Unlike \a omp_get_thread_num, this method returns the index
+  //! within the innermost \a active parallel region. It can therefore be used
+  //! to index per-thread buffers also when invoked within nested, inactive
+  //! parallel regions (e.g., element loops inside concurrent patch assembly).
+  static int getThreadNum();
+
 protected:
   //! \brief Calculates the parameter direction of the treading stripes in 2D.
   static StripDirection getStripDirection(int nel1, int nel2,
@@ -98,10 +117,46 @@ protected:
   static void printGroup(const IntMat& group, int g);
 
 public:
+  /*!
+    \brief Accumulates the busy time of the calling thread.
+    \details Instantiate an object of this class on the stack in the body of
+    a multi-threaded element loop. The elapsed time is accumulated for the
+    calling thread when it goes out of scope, if ThreadGroups::collectStats
+    is \e true.
+  */
+  class BusyTimer
+  {
+  public:
+    //! \brief The constructor starts the timer.
+    BusyTimer();
+    //! \brief The destructor accumulates the elapsed time.
+    ~BusyTimer();
+  private:
+    double t0; //!< Start time
+  };
+
+  //! \brief Resets the accumulated thread statistics.
+  static void resetStats();
+  //! \brief Prints out the accumulated busy time and task count per thread.
+  static void printStats(std::ostream& os);
+
   StripDirection stripDir; //!< Actual direction to split elements
 
+  static int  tasksPerThread; //!< Number of element tasks per thread and group
+  static bool collectStats;   //!< If \e true, accumulate per-thread busy times
+
 private:
   IntMat tg[2]; //!< Threading groups (always two, but the second may be empty)
+
+  //! \brief Per-thread statistics, padded to avoid false sharing.
+  struct ThreadStat
+  {
+    double busy;  //!< Accumulated busy time
+    size_t tasks; //!< Number of executed tasks
+    char pad[64-sizeof(double)-sizeof(size_t)]; //!< Cache line padding
+  };
+
+  static std::vector<ThreadStat> stats; //!< Busy time statistics per thread
 };
 
 #endif
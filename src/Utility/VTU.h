@@ -0,0 +1,84 @@
+// $Id$
+//==============================================================================
+//!
+//! \file VTU.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Output of FE grid blocks and nodal results to VTK XML files.
+//!
+//==============================================================================
+
+#ifndef _VTU_H
+#define _VTU_H
+
+#include <string>
+#include <vector>
+
+class ElementBlock;
+
+
+/*!
+  \brief Output of FE grid blocks and nodal results to VTK XML files.
+  \details Each grid block is written to a separate unstructured grid file
+  (.vtu), with all arrays in one appended raw binary section. The pieces are
+  tied together by a parallel unstructured grid file (.pvtu) for each time
+  level, and the time levels by a collection file (.pvd).
+
+  The pieces are written independently of each other, such that they may be
+  written concurrently from several threads or processes, and a grid block
+  can be released as soon as it has been written.
+*/
+
+namespace VTU
+{
+  //! \brief Description of a nodal result array.
+  struct Field
+  {
+    std::string name; //!< Name of the result quantity
+    size_t      ncmp; //!< Number of components per node
+    const Real* data; //!< Nodal values, with the component index running first
+  };
+
+  //! \brief Description of a data set in a collection file.
+  struct DataSet
+  {
+    double      time; //!< Time (or load parameter) of the data set
+    int         part; //!< Part index of the data set
+    std::string file; //!< Name of the file containing the data set
+  };
+
+  //! \brief Writes a grid block with nodal results to a VTU-file.
+  //! \param[in] fileName Name of the file to write
+  //! \param[in] grid The FE grid block
+  //! \param[in] fields The nodal result arrays on the grid block
+  bool writePiece(const std::string& fileName, const ElementBlock& grid,
+                  const std::vector<Field>& fields);
+
+  //! \brief Writes a PVTU-file referring a set of pieces.
+  //! \param[in] fileName Name of the file to write
+  //! \param[in] pieces File names of the pieces
+  //! \param[in] fields The nodal result arrays of each piece
+  //!
+  //! \details Only the name and number of components of the result arrays are
+  //! used, since the actual data is stored in the pieces.
+  //! The piece names are written relative to the directory of \a fileName.
+  bool writeParallel(const std::string& fileName,
+                     const std::vector<std::string>& pieces,
+                     const std::vector<Field>& fields);
+
+  //! \brief Writes a PVD-file referring a set of data sets.
+  //! \param[in] fileName Name of the file to write
+  //! \param[in] sets The data sets of the collection
+  bool writeCollection(const std::string& fileName,
+                       const std::vector<DataSet>& sets);
+
+  //! \brief Reads the data sets of an existing PVD-file.
+  //! \param[in] fileName Name of the file to read
+  //! \param[out] sets The data sets of the collection
+  bool readCollection(const std::string& fileName, std::vector<DataSet>& sets);
+}
+
+#endif
@@ -0,0 +1,88 @@
+// $Id$
+//==============================================================================
+//!
+//! \file VTUWriter.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author agent
+//!
+//! \brief Output of tessellated model and results to VTK XML files.
+//!
+//==============================================================================
+
+#ifndef _VTU_WRITER_H
+#define _VTU_WRITER_H
+
+#include "DataExporter.h"
+#include "VTU.h"
+
+
+/*!
+  \brief Write tessellated model and results to VTK XML files.
+
+  \details For each time level and registered SIM, the patches are written
+  to separate VTU-files, referred by a PVTU-file, see SIMoutput::writeVTU.
+  The time levels are collected in a PVD-file, which is rewritten after each
+  level such that it is always complete.
+*/
+
+class VTUWriter : public DataWriter
+{
+public:
+  //! \brief The constructor defines the name of the PVD-file.
+  //! \param[in] name The name (without extension) of the collection file
+  //! \param[in] adm The process administrator
+  //! \param[in] append Whether to append to or overwrite an existing file
+  VTUWriter(const std::string& name, const ProcessAdm& adm,
+            bool append = false);
+  //! \brief Empty destructor.
+  virtual ~VTUWriter() {}
+
+  //! \brief Returns the last time level stored in the collection file.
+  virtual int getLastTimeLevel();
+
+  //! \brief Opens the file at a given time level.
+  //! \param[in] level The requested time level
+  virtual void openFile(int level);
+
+  //! \brief Closes the file.
+  //! \param[in] level Level we just wrote to the file
+  virtual void closeFile(int level);
+
+  //! \brief Writes a vector to file (not supported).
+  virtual void writeVector(int, const DataEntry&) {}
+
+  //! \brief Writes data from a SIM object to file.
+  //! \param[in] level The time level to write the data at
+  //! \param[in] entry The DataEntry describing the vector
+  //! \param[in] prefix Field name prefix
+  virtual void writeSIM(int level, const DataEntry& entry,
+                        bool, const std::string& prefix);
+
+  //! \brief Writes nodal forces to file (not supported).
+  virtual void writeNodalForces(int, const DataEntry&) {}
+
+  //! \brief Writes a knotspan field to file (not supported).
+  virtual void writeKnotspan(int, const DataEntry&, const std::string&) {}
+
+  //! \brief Writes a basis to file (not supported).
+  virtual void writeBasis(int, const DataEntry&, const std::string&) {}
+
+  //! \brief Writes time stepping info to file.
+  //! \param[in] level The time level to write the info at
+  //! \param[in] tp The current time stepping info
+  virtual bool writeTimeInfo(int level, int, const TimeStep& tp);
+
+  //! \brief Writes a log to output file (not supported).
+  virtual bool writeLog(const std::string&, const std::string&) { return true; }
+
+private:
+  std::string m_base; //!< File name prefix of the PVTU-files
+  double      m_time; //!< Time of the current time level
+
+  std::vector<VTU::DataSet> m_sets;    //!< Data sets of the collection file
+  std::vector<std::string>  m_entries; //!< Names of the registered SIMs
+};
+
+#endif